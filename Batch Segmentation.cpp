@@ -0,0 +1,106 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef _CRT_SECURE_NO_WARNINGS
+    #define _CRT_SECURE_NO_WARNINGS
+#endif
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Segmentation/BatchProcessing.h"
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(int argc, char* argv[])
+{
+    static const char*  USAGE            = "Usage: %s input [output directory] [width] [height] [otsu|kapur|iterative] [K] [threads] "
+                                           "[sample stride]\n";
+    static const char*  OUTPUT_DIRECTORY = ".";
+    static const char*  OUTPUT_SUFFIX    = "_Segmentation.raw";
+    static const size_t WIDTH            = 303;
+    static const size_t HEIGHT           = 243;
+
+    if (argc < 2)
+    {
+        fprintf(stderr, USAGE, argv[0]);
+        return 1;
+    }
+
+    const char* inputName       = argv[1];
+    const char* outputDirectory = (argc > 2) ? (argv[2]) : (OUTPUT_DIRECTORY);
+    size_t      width           = (argc > 3) ? (strtoul(argv[3], NULL, 10)) : (WIDTH);
+    size_t      height          = (argc > 4) ? (strtoul(argv[4], NULL, 10)) : (HEIGHT);
+    const char* methodName      = (argc > 5) ? (argv[5]) : ("otsu");
+    uint32_t    extractNumber   = (argc > 6) ? (static_cast<uint32_t>(strtoul(argv[6], NULL, 10))) : (2);
+    size_t      workerNumber    = (argc > 7) ? (strtoul(argv[7], NULL, 10)) : (static_cast<size_t>(-1));
+    size_t      sampleStride    = (argc > 8) ? (strtoul(argv[8], NULL, 10)) : (1);
+
+    BatchPipeline            pipeline = MakeBatchPipeline(width, height);
+    std::vector<std::string> inputFileName;
+    std::vector<BatchFrame>  frame;
+
+    if (strcmp(methodName, "otsu") == 0)
+        pipeline.thresholdMethod = THRESHOLD_METHOD_OTSU;
+    else if (strcmp(methodName, "kapur") == 0)
+        pipeline.thresholdMethod = THRESHOLD_METHOD_KAPUR;
+    else if (strcmp(methodName, "iterative") == 0)
+        pipeline.thresholdMethod = THRESHOLD_METHOD_ITERATIVE;
+    else
+    {
+        fprintf(stderr, "[Batch Segmentation] Unknown threshold method %s\n", methodName);
+        fprintf(stderr, USAGE, argv[0]);
+        return 1;
+    }
+
+    pipeline.sampleStride = (sampleStride > 0) ? (sampleStride) : (1);
+
+    // K = 0 stops after thresholding and writes the binary masks.
+    pipeline.labeling          = (extractNumber > 0);
+    pipeline.areaExtractNumber = extractNumber;
+
+    // A directory lists its '.raw' frames, anything else is read as a list with one frame path per line.
+    if (ListRawDirectory(inputName, inputFileName) == false && ReadRawFileList(inputName, inputFileName) == false)
+    {
+        fprintf(stderr, "[Batch Segmentation] Can't open %s\n", inputName);
+        return 1;
+    }
+
+    for (size_t fileIndex = 0; fileIndex < inputFileName.size(); ++fileIndex)
+    {
+        std::string baseName  = inputFileName[fileIndex].substr(inputFileName[fileIndex].find_last_of("/\\") + 1);
+        size_t      extension = baseName.rfind('.');
+
+        // Outputs of an earlier run into the input directory aren't frames.
+        if (baseName.size() >= strlen(OUTPUT_SUFFIX) && baseName.compare(baseName.size() - strlen(OUTPUT_SUFFIX), std::string::npos, OUTPUT_SUFFIX) == 0)
+            continue;
+
+        if (extension != std::string::npos)
+            baseName.erase(extension);
+
+        frame.push_back({ inputFileName[fileIndex], std::string(outputDirectory) + "/" + baseName + OUTPUT_SUFFIX });
+    }
+
+    // The calling thread works too, so 'workerNumber' threads need 'workerNumber - 1' pool workers.
+    ThreadPool  threadPool((workerNumber == static_cast<size_t>(-1) || workerNumber == 0) ? (workerNumber) : (workerNumber - 1));
+    BatchReport report = RunBatch(frame, pipeline, threadPool);
+
+    printf("[Batch Segmentation] %zu frames, %zu failed, %.3f s, %.1f frames/s on %zu threads\n",
+           report.frameNumber, report.failedFrameNumber, report.elapsedSeconds, report.framesPerSecond, threadPool.ThreadNumber());
+
+    for (int stage = 0; stage < BATCH_STAGE_NUMBER; ++stage)
+    {
+        const BatchStageLatency& latency = report.stageLatency[stage];
+
+        printf("[Batch Segmentation] %-9s p50 %8.3f ms, p90 %8.3f ms, p99 %8.3f ms, max %8.3f ms\n",
+               BatchStageName(static_cast<BatchStage>(stage)), latency.p50, latency.p90, latency.p99, latency.max);
+    }
+
+    return (report.failedFrameNumber == 0) ? (0) : (1);
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
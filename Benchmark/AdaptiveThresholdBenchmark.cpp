@@ -0,0 +1,92 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/Binarization.h"
+#include "Segmentation/Histogram.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +------------------------------------------< GLOBAL VARIABLE >-------------------------------------------+
+
+static const size_t WIDTH     = 3840;
+static const size_t HEIGHT    = 2160;
+static const size_t TILE_SIZE = 128;
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    static const ThresholdMethod METHOD[]      = { THRESHOLD_METHOD_OTSU, THRESHOLD_METHOD_KAPUR, THRESHOLD_METHOD_ITERATIVE };
+    static const char*           METHOD_NAME[] = { "Otsu", "Kapur", "Iterative" };
+
+    std::vector<byte_t> objectMask      = GenerateBlobMask(WIDTH, HEIGHT, 400, 60);
+    std::vector<byte_t> inputImage(WIDTH * HEIGHT);
+    std::vector<byte_t> globalImage(WIDTH * HEIGHT);
+    std::vector<byte_t> outputImage(WIDTH * HEIGHT);
+    ImageView           inputImageView  = MakeImageView(inputImage.data(), WIDTH, HEIGHT);
+    ImageView           globalImageView = MakeImageView(globalImage.data(), WIDTH, HEIGHT);
+    ImageView           outputImageView = MakeImageView(outputImage.data(), WIDTH, HEIGHT);
+    std::mt19937        generator(1);
+    uint32_t            histogram[256];
+    int                 exitCode        = 0;
+
+    // Bright parts on a darker belt with sensor noise, lit from the right: the illumination falls to a third
+    // on the left, so the parts there end up darker than the belt on the right.
+    for (size_t iy = 0; iy < HEIGHT; ++iy)
+        for (size_t ix = 0; ix < WIDTH; ++ix)
+        {
+            size_t brightness = ((objectMask[iy * WIDTH + ix] != 0) ? (180) : (70)) + generator() % 24;
+
+            inputImage[iy * WIDTH + ix] = static_cast<byte_t>(brightness * (WIDTH + 2 * ix) / (3 * WIDTH));
+        }
+
+    printf("[Adaptive Threshold] %zux%zu frame of parts under a lighting ramp, %zux%zu tiles\n", WIDTH, HEIGHT, TILE_SIZE, TILE_SIZE);
+
+    for (int methodIndex = 0; methodIndex < 3; ++methodIndex)
+    {
+        ThresholdMethod method = METHOD[methodIndex];
+
+        byte_t globalThreshold = SelectThreshold(method, ComputeHistogram(inputImageView, histogram), inputImageView);
+
+        BinarizeImage(inputImageView, globalImageView, globalThreshold);
+
+        // With every tile forced onto the global threshold the adaptive path must reproduce the global selector.
+        AdaptiveThresholdSelection(method, inputImageView, outputImageView, TILE_SIZE, TILE_SIZE, 256);
+
+        if (outputImage != globalImage)
+        {
+            fprintf(stderr, "[Adaptive Threshold] %s flat-tile mismatch\n", METHOD_NAME[methodIndex]);
+            exitCode = 1;
+        }
+
+        AdaptiveThresholdSelection(method, inputImageView, outputImageView, TILE_SIZE, TILE_SIZE);
+
+        size_t globalError   = 0;
+        size_t adaptiveError = 0;
+
+        for (size_t index = 0; index < WIDTH * HEIGHT; ++index)
+        {
+            bool foreground = objectMask[index] != 0;
+
+            globalError   += ((globalImage[index] != 0) != foreground) ? (1) : (0);
+            adaptiveError += ((outputImage[index] != 0) != foreground) ? (1) : (0);
+        }
+
+        double global   = MeasureNanoseconds([&]()
+        {
+            BinarizeImage(inputImageView, globalImageView, SelectThreshold(method, ComputeHistogram(inputImageView, histogram), inputImageView));
+        }, 5);
+        double adaptive = MeasureNanoseconds([&]() { AdaptiveThresholdSelection(method, inputImageView, outputImageView, TILE_SIZE, TILE_SIZE); }, 5);
+
+        printf("[Adaptive Threshold] %-9s : global %7.3f ms (%5.2f %% misclassified), adaptive %7.3f ms (%5.2f %% misclassified), "
+               "cost %4.2fx\n", METHOD_NAME[methodIndex], global / 1e6, 100.0 * globalError / (WIDTH * HEIGHT), adaptive / 1e6,
+               100.0 * adaptiveError / (WIDTH * HEIGHT), adaptive / global);
+    }
+
+    return exitCode;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,127 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/Labeling.h"
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    static const uint32_t LABEL_NUMBER[]        = { 1000, 10000, 100000 };
+    static const uint32_t AREA_EXTRACT_NUMBER[] = { 1, 10, 100, 1000 };
+
+    std::mt19937 generator(1);
+    int          exitCode = 0;
+
+    for (size_t labelIndex = 0; labelIndex < sizeof(LABEL_NUMBER) / sizeof(LABEL_NUMBER[0]); ++labelIndex)
+    {
+        const uint32_t labelNumber = LABEL_NUMBER[labelIndex];
+
+        // Small areas so that ties, which the selection has to break like the exhaustive scans, are common.
+        std::vector<uint32_t> labelHistogram(labelNumber);
+
+        for (uint32_t label = 1; label < labelNumber; ++label)
+            labelHistogram[label] = generator() % 4096;
+
+        for (size_t extractIndex = 0; extractIndex < sizeof(AREA_EXTRACT_NUMBER) / sizeof(AREA_EXTRACT_NUMBER[0]); ++extractIndex)
+        {
+            const uint32_t areaExtractNumber = AREA_EXTRACT_NUMBER[extractIndex];
+
+            std::vector<uint32_t> referenceLabel(areaExtractNumber, 0);
+            std::vector<uint32_t> extractedLabel(areaExtractNumber, 0);
+
+            ExhaustiveSelectLargeAreaLabel(labelHistogram.data(), labelNumber, referenceLabel.data(), areaExtractNumber);
+            SelectLargeAreaLabel(labelHistogram.data(), labelNumber, extractedLabel.data(), areaExtractNumber);
+
+            if (extractedLabel != referenceLabel)
+            {
+                fprintf(stderr, "[Area Selection] L=%" PRIu32 " K=%" PRIu32 ": selection differs from the exhaustive scans\n",
+                        labelNumber, areaExtractNumber);
+                exitCode = 1;
+            }
+
+            double exhaustive = MeasureNanoseconds([&]()
+            {
+                std::fill(referenceLabel.begin(), referenceLabel.end(), 0);
+                ExhaustiveSelectLargeAreaLabel(labelHistogram.data(), labelNumber, referenceLabel.data(), areaExtractNumber);
+            }, 1, 3);
+
+            double selection = MeasureNanoseconds([&]()
+            {
+                std::fill(extractedLabel.begin(), extractedLabel.end(), 0);
+                SelectLargeAreaLabel(labelHistogram.data(), labelNumber, extractedLabel.data(), areaExtractNumber);
+            }, 10, 3);
+
+            printf("[Area Selection] L=%6" PRIu32 " K=%4" PRIu32 " : exhaustive %10.3f ms, top-K %7.3f ms, speedup %8.1fx\n",
+                   labelNumber, areaExtractNumber, exhaustive / 1e6, selection / 1e6, exhaustive / selection);
+        }
+    }
+
+    // Mask generation on a 4K label plane: compare every pixel with every extracted label, or look it up.
+    {
+        static const size_t WIDTH  = 3840;
+        static const size_t HEIGHT = 2160;
+
+        const uint32_t labelNumber = 10000;
+
+        std::vector<uint32_t> label(WIDTH * HEIGHT);
+        std::vector<byte_t>   referenceMask(WIDTH * HEIGHT);
+        std::vector<byte_t>   mask(WIDTH * HEIGHT);
+        std::vector<byte_t>   keepTable(labelNumber);
+
+        for (size_t index = 0; index < label.size(); ++index)
+            label[index] = static_cast<uint32_t>((index / 64) % labelNumber);
+
+        for (size_t extractIndex = 0; extractIndex < sizeof(AREA_EXTRACT_NUMBER) / sizeof(AREA_EXTRACT_NUMBER[0]); ++extractIndex)
+        {
+            const uint32_t areaExtractNumber = AREA_EXTRACT_NUMBER[extractIndex];
+
+            std::vector<uint32_t> extractedLabel(areaExtractNumber);
+
+            for (uint32_t index = 0; index < areaExtractNumber; ++index)
+                extractedLabel[index] = index * (labelNumber / areaExtractNumber);
+
+            double scan = MeasureNanoseconds([&]()
+            {
+                for (size_t index = 0; index < label.size(); ++index)
+                {
+                    referenceMask[index] = 0;
+
+                    for (uint32_t extract = 0; extract < areaExtractNumber; ++extract)
+                        if (label[index] == extractedLabel[extract])
+                        {
+                            referenceMask[index] = 255;
+                            break;
+                        }
+                }
+            }, 1, 1);
+
+            double lookup = MeasureNanoseconds([&]()
+            {
+                MakeLabelKeepTable(extractedLabel.data(), areaExtractNumber, labelNumber, keepTable.data());
+
+                for (size_t index = 0; index < label.size(); ++index)
+                    mask[index] = keepTable[label[index]];
+            }, 1, 3);
+
+            if (mask != referenceMask)
+            {
+                fprintf(stderr, "[Area Selection] K=%" PRIu32 ": lookup mask differs\n", areaExtractNumber);
+                exitCode = 1;
+            }
+
+            printf("[Area Selection] 4K mask K=%4" PRIu32 " : scan %9.3f ms, lookup %7.3f ms, speedup %8.1fx\n",
+                   areaExtractNumber, scan / 1e6, lookup / 1e6, scan / lookup);
+        }
+    }
+
+    return exitCode;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,194 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef SEGMENTATION_BENCHMARK_H
+#define SEGMENTATION_BENCHMARK_H
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Segmentation/Image.h"
+#include "Segmentation/RawFile.h"
+
+// +---------------------------------------------< BENCHMARK >----------------------------------------------+
+
+// Runs 'function' 'repeatNumber' times per round and returns the best round's average duration of one call.
+template <typename Function>
+double MeasureNanoseconds(Function function, size_t repeatNumber, size_t roundNumber = 5)
+{
+    double bestNanoseconds = 0.0;
+
+    for (size_t roundIndex = 0; roundIndex < roundNumber; ++roundIndex)
+    {
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+        for (size_t repeatIndex = 0; repeatIndex < repeatNumber; ++repeatIndex)
+            function();
+
+        double nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count() / repeatNumber;
+
+        bestNanoseconds = (roundIndex == 0) ? (nanoseconds) : (std::min(bestNanoseconds, nanoseconds));
+    }
+
+    return bestNanoseconds;
+}
+
+// Reads a frame shipped in 'Resource/', e.g. "hand.raw".
+inline bool ReadResourceImage(const char* fileName, const ImageView& image)
+{
+    return ReadRawImage((std::string(SEGMENTATION_RESOURCE_DIRECTORY "/") + fileName).c_str(), image);
+}
+
+// Synthetic frames. A 'natural' frame is Resource/hand.raw scaled to the requested size with nearest neighbour
+// sampling, which keeps its histogram and its long runs of equal pixels.
+inline std::vector<byte_t> GenerateUniformImage(size_t width, size_t height, uint32_t seed = 1)
+{
+    std::vector<byte_t> image(width * height);
+    std::mt19937        generator(seed);
+
+    for (size_t index = 0; index < image.size(); ++index)
+        image[index] = static_cast<byte_t>(generator());
+
+    return image;
+}
+
+inline std::vector<byte_t> GenerateConstantImage(size_t width, size_t height, byte_t brightness = 128)
+{
+    return std::vector<byte_t>(width * height, brightness);
+}
+
+inline std::vector<byte_t> GenerateNaturalImage(size_t width, size_t height)
+{
+    static const size_t HAND_WIDTH  = 303;
+    static const size_t HAND_HEIGHT = 243;
+
+    std::vector<byte_t> handImage(HAND_WIDTH * HAND_HEIGHT, 0);
+    std::vector<byte_t> image(width * height);
+
+    ReadResourceImage("hand.raw", MakeImageView(handImage.data(), HAND_WIDTH, HAND_HEIGHT));
+
+    for (size_t iy = 0; iy < height; ++iy)
+        for (size_t ix = 0; ix < width; ++ix)
+            image[iy * width + ix] = handImage[(iy * HAND_HEIGHT / height) * HAND_WIDTH + (ix * HAND_WIDTH / width)];
+
+    return image;
+}
+
+// Binary 0/255 mask of 'blobNumber' random disks with radii up to 'maxRadius'.
+inline std::vector<byte_t> GenerateBlobMask(size_t width, size_t height, size_t blobNumber, size_t maxRadius, uint32_t seed = 1)
+{
+    std::vector<byte_t> mask(width * height, 0);
+    std::mt19937        generator(seed);
+
+    for (size_t blobIndex = 0; blobIndex < blobNumber; ++blobIndex)
+    {
+        long centerX = static_cast<long>(generator() % width);
+        long centerY = static_cast<long>(generator() % height);
+        long radius  = static_cast<long>(1 + generator() % maxRadius);
+
+        for (long iy = std::max(0L, centerY - radius); iy <= std::min(static_cast<long>(height) - 1, centerY + radius); ++iy)
+            for (long ix = std::max(0L, centerX - radius); ix <= std::min(static_cast<long>(width) - 1, centerX + radius); ++ix)
+                if ((ix - centerX) * (ix - centerX) + (iy - centerY) * (iy - centerY) <= radius * radius)
+                    mask[iy * width + ix] = 255;
+    }
+
+    return mask;
+}
+
+// Frame 'frameIndex' of a stream of 'diskNumber' bright disks drifting over a dark noisy background, bouncing
+// off the frame borders. Radii shrink from 'radius' towards half of it, so the disks differ in area.
+// Consecutive frames differ by a few pixels of motion and new noise.
+inline std::vector<byte_t> GenerateMovingDiskFrame(size_t width, size_t height, size_t diskNumber, size_t radius, size_t frameIndex, uint32_t seed = 1)
+{
+    std::vector<byte_t> image(width * height);
+    std::mt19937        diskGenerator(seed);
+    std::mt19937        noiseGenerator(seed + static_cast<uint32_t>(frameIndex) * 7919);
+
+    for (size_t index = 0; index < image.size(); ++index)
+        image[index] = static_cast<byte_t>(24 + noiseGenerator() % 16);
+
+    for (size_t diskIndex = 0; diskIndex < diskNumber; ++diskIndex)
+    {
+        const long diskRadius = static_cast<long>(radius - diskIndex * radius / (2 * diskNumber));
+        const long range[2]   = { static_cast<long>(width) - 2 * diskRadius, static_cast<long>(height) - 2 * diskRadius };
+        long       center[2]  = { 0, 0 };
+
+        for (int axis = 0; axis < 2; ++axis)
+        {
+            long start    = static_cast<long>(diskGenerator() % range[axis]);
+            long velocity = static_cast<long>(diskGenerator() % 9) - 4;
+            long position = ((start + velocity * static_cast<long>(frameIndex)) % (2 * range[axis]) + 2 * range[axis]) % (2 * range[axis]);
+
+            center[axis] = diskRadius + ((position < range[axis]) ? (position) : (2 * range[axis] - position));
+        }
+
+        for (long iy = center[1] - diskRadius; iy <= center[1] + diskRadius; ++iy)
+            for (long ix = center[0] - diskRadius; ix <= center[0] + diskRadius; ++ix)
+                if ((ix - center[0]) * (ix - center[0]) + (iy - center[1]) * (iy - center[1]) <= diskRadius * diskRadius &&
+                    ix < static_cast<long>(width) && iy < static_cast<long>(height))
+                    image[iy * width + ix] = static_cast<byte_t>(192 + noiseGenerator() % 48);
+    }
+
+    return image;
+}
+
+// Binary 0/255 mask of a single one pixel wide square spiral winding inwards from the top-left corner with one
+// pixel gaps, the worst case for the iterative 2-pass labeling.
+inline std::vector<byte_t> GenerateSpiralMask(size_t width, size_t height)
+{
+    std::vector<byte_t> mask(width * height, 0);
+    long                left   = 0;
+    long                top    = 0;
+    long                right  = static_cast<long>(width) - 1;
+    long                bottom = static_cast<long>(height) - 1;
+    long                startX = 0;
+
+    while (left <= right && top <= bottom)
+    {
+        for (long ix = startX; ix <= right; ++ix)
+            mask[top * width + ix] = 255;
+        for (long iy = top; iy <= bottom; ++iy)
+            mask[iy * width + right] = 255;
+
+        if (bottom - top < 2 || right - left < 2)
+            break;
+
+        for (long ix = right; ix >= left; --ix)
+            mask[bottom * width + ix] = 255;
+
+        if (bottom - top < 4)
+            break;
+
+        for (long iy = bottom; iy >= top + 2; --iy)
+            mask[iy * width + left] = 255;
+
+        startX  = left;
+        top    += 2;
+        right  -= 2;
+        bottom -= 2;
+        left   += 2;
+    }
+
+    return mask;
+}
+
+// Binary 0/255 checkerboard of 'cellSize' squares. One pixel cells join all foreground diagonally.
+inline std::vector<byte_t> GenerateCheckerboardMask(size_t width, size_t height, size_t cellSize)
+{
+    std::vector<byte_t> mask(width * height);
+
+    for (size_t iy = 0; iy < height; ++iy)
+        for (size_t ix = 0; ix < width; ++ix)
+            mask[iy * width + ix] = (((ix / cellSize) + (iy / cellSize)) % 2 == 0) ? (255) : (0);
+
+    return mask;
+}
+
+#endif
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,77 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/Binarization.h"
+#include "Segmentation/Histogram.h"
+
+// +------------------------------------------< GLOBAL VARIABLE >-------------------------------------------+
+
+static const size_t WIDTH     = 3840;
+static const size_t HEIGHT    = 2160;
+static const byte_t THRESHOLD = 72;
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    static const SimdKernel KERNEL[] = { SIMD_KERNEL_SCALAR, SIMD_KERNEL_SSE2, SIMD_KERNEL_AVX2 };
+
+    std::vector<byte_t> inputImage         = GenerateNaturalImage(WIDTH, HEIGHT);
+    std::vector<byte_t> referenceImage(WIDTH * HEIGHT);
+    std::vector<byte_t> outputImage(WIDTH * HEIGHT);
+    ImageView           inputImageView     = MakeImageView(inputImage.data(), WIDTH, HEIGHT);
+    ImageView           outputImageView    = MakeImageView(outputImage.data(), WIDTH, HEIGHT);
+    uint32_t            referenceHistogram[256];
+    uint32_t            histogram[256];
+    int                 exitCode           = 0;
+
+    for (size_t index = 0; index < WIDTH * HEIGHT; ++index)
+        referenceImage[index] = (inputImage[index] < THRESHOLD) ? (0) : (255);
+
+    ComputeHistogram(inputImageView, referenceHistogram, SIMD_KERNEL_SCALAR);
+
+    printf("[Binarization] %zux%zu natural frame, detected kernel %s\n", WIDTH, HEIGHT, SimdKernelName(DetectSimdKernel()));
+
+    for (size_t kernelIndex = 0; kernelIndex < sizeof(KERNEL) / sizeof(KERNEL[0]); ++kernelIndex)
+    {
+        SimdKernel kernel = KERNEL[kernelIndex];
+
+        if (ResolveSimdKernel(kernel) != kernel)
+            continue;
+
+        BinarizeImage(inputImageView, outputImageView, THRESHOLD, kernel);
+
+        if (outputImage != referenceImage)
+        {
+            fprintf(stderr, "[Binarization] %s binarize mismatch\n", SimdKernelName(kernel));
+            exitCode = 1;
+        }
+
+        BinarizeWithHistogram(inputImageView, outputImageView, THRESHOLD, histogram, kernel);
+
+        if (outputImage != referenceImage || memcmp(histogram, referenceHistogram, sizeof(histogram)) != 0)
+        {
+            fprintf(stderr, "[Binarization] %s fused pass mismatch\n", SimdKernelName(kernel));
+            exitCode = 1;
+        }
+
+        double binarize = MeasureNanoseconds([&]() { BinarizeImage(inputImageView, outputImageView, THRESHOLD, kernel); }, 10);
+        double twoPass  = MeasureNanoseconds([&]()
+        {
+            ComputeHistogram(inputImageView, histogram, kernel);
+            BinarizeImage(inputImageView, outputImageView, THRESHOLD, kernel);
+        }, 10);
+        double fused    = MeasureNanoseconds([&]() { BinarizeWithHistogram(inputImageView, outputImageView, THRESHOLD, histogram, kernel); }, 10);
+
+        printf("[Binarization] %-6s : binarize %7.3f ms, histogram + binarize %7.3f ms, fused %7.3f ms\n",
+               SimdKernelName(kernel), binarize / 1e6, twoPass / 1e6, fused / 1e6);
+    }
+
+    return exitCode;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
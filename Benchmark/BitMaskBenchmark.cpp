@@ -0,0 +1,130 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cstdio>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/Binarization.h"
+#include "Segmentation/BitMask.h"
+#include "Segmentation/Labeling.h"
+#include "Segmentation/RawFile.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +------------------------------------------< GLOBAL VARIABLE >-------------------------------------------+
+
+static const char* BYTE_FILE_NAME = "BitMaskBenchmark_Mask.raw";
+static const char* BIT_FILE_NAME  = "BitMaskBenchmark_Mask.bits";
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+// The 0/255 mask path against the bit mask path on the same masks: conversion from the grayscale frame, 2-pass
+// labeling, 3x3 opening and closing, and a file round trip. Files stay in the page cache, so the file timings
+// compare the bytes copied, not the disk.
+int main(void)
+{
+    static const size_t SIZE[][2] = { { 1920, 1080 }, { 3840, 2160 } };
+
+    int exitCode = 0;
+
+    for (size_t sizeIndex = 0; sizeIndex < sizeof(SIZE) / sizeof(SIZE[0]); ++sizeIndex)
+    {
+        const size_t width  = SIZE[sizeIndex][0];
+        const size_t height = SIZE[sizeIndex][1];
+
+        std::vector<byte_t> inputImage     = GenerateNaturalImage(width, height);
+        std::vector<byte_t> maskImage(width * height);
+        std::vector<byte_t> outputImage(width * height);
+        std::vector<byte_t> unpackedImage(width * height);
+        ImageView           inputView      = MakeImageView(inputImage.data(), width, height);
+        ImageView           maskView       = MakeImageView(maskImage.data(), width, height);
+        ImageView           outputView     = MakeImageView(outputImage.data(), width, height);
+        ImageView           unpackedView   = MakeImageView(unpackedImage.data(), width, height);
+        LabelingWorkspace   workspace;
+        BitMask             mask;
+        BitMask             outputMask;
+        BitMask             temporaryMask;
+        byte_t              threshold      = OtsuThresholdSelection(inputView, maskView);
+
+        ThresholdBitMask(inputView, threshold, &mask);
+
+        printf("[Bit Mask] %4zux%-4zu : 0/255 mask %8zu bytes, bit mask %8zu bytes (%5.2fx smaller)\n", width, height, width * height,
+               mask.word.size() * sizeof(uint64_t), static_cast<double>(width * height) / (mask.word.size() * sizeof(uint64_t)));
+
+        double binarize = MeasureNanoseconds([&]() { BinarizeImage(inputView, maskView, threshold); }, 10);
+        double pack     = MeasureNanoseconds([&]() { PackBitMask(maskView, &mask); }, 10);
+        double convert  = MeasureNanoseconds([&]() { ThresholdBitMask(inputView, threshold, &mask); }, 10);
+
+        printf("[Bit Mask] %4zux%-4zu : binarize %7.3f ms, pack 0/255 mask %7.3f ms, threshold to bits %7.3f ms\n", width, height,
+               binarize / 1e6, pack / 1e6, convert / 1e6);
+
+        // Natural frames give ragged masks with many short runs, blob masks few long ones.
+        for (int maskIndex = 0; maskIndex < 2; ++maskIndex)
+        {
+            const char* maskName = (maskIndex == 0) ? ("natural") : ("blobs");
+
+            if (maskIndex == 1)
+            {
+                maskImage = GenerateBlobMask(width, height, 64, height / 12);
+                maskView  = MakeImageView(maskImage.data(), width, height);
+            }
+
+            PackBitMask(maskView, &mask);
+
+            RunLengthEfficient2Pass(maskView, outputView, 3, &workspace);
+            BitMaskEfficient2Pass(mask, &outputMask, 3, NULL, &workspace);
+            UnpackBitMask(outputMask, unpackedView);
+
+            if (unpackedImage != outputImage)
+            {
+                fprintf(stderr, "[Bit Mask] %zux%zu %s: bit mask labeling differs from the 0/255 mask\n", width, height, maskName);
+                exitCode = 1;
+            }
+
+            double byteLabeling = MeasureNanoseconds([&]() { RunLengthEfficient2Pass(maskView, outputView, 3, &workspace); }, 5);
+            double bitLabeling  = MeasureNanoseconds([&]() { BitMaskEfficient2Pass(mask, &outputMask, 3, NULL, &workspace); }, 5);
+            double open         = MeasureNanoseconds([&]() { OpenBitMask(mask, &outputMask, &temporaryMask); }, 10);
+            double close        = MeasureNanoseconds([&]() { CloseBitMask(mask, &outputMask, &temporaryMask); }, 10);
+
+            printf("[Bit Mask] %4zux%-4zu %-7s : run-length labeling %7.3f ms, bit mask labeling %7.3f ms (%5.2fx), "
+                   "open %6.3f ns/pixel, close %6.3f ns/pixel\n", width, height, maskName, byteLabeling / 1e6, bitLabeling / 1e6,
+                   byteLabeling / bitLabeling, open / (width * height), close / (width * height));
+        }
+
+        if (WriteRawImage(BYTE_FILE_NAME, maskView) == false || WriteBitMask(BIT_FILE_NAME, mask) == false)
+        {
+            fprintf(stderr, "[Bit Mask] Can't write the mask files\n");
+            exitCode = 1;
+            continue;
+        }
+
+        ReadBitMask(BIT_FILE_NAME, width, height, &outputMask);
+        UnpackBitMask(outputMask, unpackedView);
+
+        if (unpackedImage != maskImage)
+        {
+            fprintf(stderr, "[Bit Mask] %zux%zu: mask file round trip mismatch\n", width, height);
+            exitCode = 1;
+        }
+
+        double byteFile = MeasureNanoseconds([&]()
+        {
+            WriteRawImage(BYTE_FILE_NAME, maskView);
+            ReadRawImage(BYTE_FILE_NAME, maskView);
+        }, 5);
+        double bitFile  = MeasureNanoseconds([&]()
+        {
+            WriteBitMask(BIT_FILE_NAME, mask);
+            ReadBitMask(BIT_FILE_NAME, width, height, &mask);
+        }, 5);
+
+        printf("[Bit Mask] %4zux%-4zu : write + read 0/255 file %7.3f ms, bit mask file %7.3f ms (%5.2fx)\n", width, height, byteFile / 1e6,
+               bitFile / 1e6, byteFile / bitFile);
+    }
+
+    remove(BYTE_FILE_NAME);
+    remove(BIT_FILE_NAME);
+
+    return exitCode;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
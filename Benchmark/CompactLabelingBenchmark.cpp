@@ -0,0 +1,77 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cstdio>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/Binarization.h"
+#include "Segmentation/Labeling.h"
+
+// +---------------------------------------------< BENCHMARK >----------------------------------------------+
+
+// Runs the union-find and the compact mode on 'mask' with workspaces of their own, so that the workspace
+// capacity after one frame is the scratch memory each mode needs.
+static int BenchmarkFrame(const char* frameName, std::vector<byte_t>& mask, size_t width, size_t height)
+{
+    ImageView           maskView         = MakeImageView(mask.data(), width, height);
+    std::vector<byte_t> referenceImage(width * height);
+    std::vector<byte_t> outputImage(width * height);
+    ImageView           outputImageView  = MakeImageView(outputImage.data(), width, height);
+    LabelingWorkspace   unionFindWorkspace;
+    LabelingWorkspace   compactWorkspace;
+    int                 exitCode         = 0;
+
+    Efficient2Pass(maskView, MakeImageView(referenceImage.data(), width, height), 8, LABELING_MODE_UNION_FIND, NULL, NULL, &unionFindWorkspace);
+    Efficient2Pass(maskView, outputImageView, 8, LABELING_MODE_COMPACT_UNION_FIND, NULL, NULL, &compactWorkspace);
+
+    if (outputImage != referenceImage)
+    {
+        fprintf(stderr, "[Compact Labeling] %s: output differs from union-find\n", frameName);
+        exitCode = 1;
+    }
+
+    // A compact run that fell back has filled the 32-bit label plane too.
+    bool   fallback  = (compactWorkspace.label.empty() == false);
+    double unionFind = MeasureNanoseconds([&]() { Efficient2Pass(maskView, outputImageView, 8, LABELING_MODE_UNION_FIND, NULL, NULL, &unionFindWorkspace); }, 3);
+    double compact   = MeasureNanoseconds([&]() { Efficient2Pass(maskView, outputImageView, 8, LABELING_MODE_COMPACT_UNION_FIND, NULL, NULL, &compactWorkspace); }, 3);
+
+    printf("[Compact Labeling] %-22s : union-find %8.3f ms %7.1f MB, compact %8.3f ms %7.1f MB, speedup %4.2fx%s\n",
+           frameName, unionFind / 1e6, LabelingWorkspaceCapacity(unionFindWorkspace) / 1e6,
+           compact / 1e6, LabelingWorkspaceCapacity(compactWorkspace) / 1e6, unionFind / compact, (fallback) ? (" (fell back)") : (""));
+
+    return exitCode;
+}
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    std::vector<byte_t> handMask(303 * 243);
+    std::vector<byte_t> naturalImage = GenerateNaturalImage(3840, 2160);
+    std::vector<byte_t> naturalMask(3840 * 2160);
+    std::vector<byte_t> sparseMask   = GenerateBlobMask(3840, 2160, 5000, 20);
+    std::vector<byte_t> dotMask(1920 * 1080, 0);
+    int                 exitCode     = 0;
+
+    if (ReadResourceImage("hand_OtsuThresholdSelection.raw", MakeImageView(handMask.data(), 303, 243)) == false)
+    {
+        fprintf(stderr, "[Compact Labeling] Can't read hand_OtsuThresholdSelection.raw\n");
+        return 1;
+    }
+
+    BinarizeImage(MakeImageView(naturalImage.data(), 3840, 2160), MakeImageView(naturalMask.data(), 3840, 2160), 72);
+
+    // Isolated pixels on every other row and column, far more components than 16-bit labels can number.
+    for (size_t iy = 0; iy < 1080; iy += 2)
+        for (size_t ix = 0; ix < 1920; ix += 2)
+            dotMask[iy * 1920 + ix] = 255;
+
+    exitCode |= BenchmarkFrame("303x243 hand", handMask, 303, 243);
+    exitCode |= BenchmarkFrame("3840x2160 natural", naturalMask, 3840, 2160);
+    exitCode |= BenchmarkFrame("3840x2160 5000 blobs", sparseMask, 3840, 2160);
+    exitCode |= BenchmarkFrame("1920x1080 dot grid", dotMask, 1920, 1080);
+
+    return exitCode;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,70 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cinttypes>
+#include <cstdio>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/ComponentStatistics.h"
+#include "Segmentation/Labeling.h"
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    static const size_t WIDTH  = 3840;
+    static const size_t HEIGHT = 2160;
+
+    struct
+    {
+        const char*  name;
+        LabelingMode mode;
+    }
+    labeling[] =
+    {
+        { "union-find", LABELING_MODE_UNION_FIND },
+        { "run-length", LABELING_MODE_RUN_LENGTH }
+    };
+
+    std::vector<byte_t> mask            = GenerateBlobMask(WIDTH, HEIGHT, 5000, 40);
+    std::vector<byte_t> intensityImage  = GenerateNaturalImage(WIDTH, HEIGHT);
+    std::vector<byte_t> outputImage(WIDTH * HEIGHT);
+    ImageView           maskView        = MakeImageView(mask.data(), WIDTH, HEIGHT);
+    ImageView           intensityView   = MakeImageView(intensityImage.data(), WIDTH, HEIGHT);
+    ImageView           outputImageView = MakeImageView(outputImage.data(), WIDTH, HEIGHT);
+    LabelingWorkspace   workspace;
+    ComponentStatistics statistics;
+    ComponentFilter     filter          = MakeComponentFilter();
+    uint32_t            keptNumber      = 0;
+
+    // Keep mid-sized, roughly round blobs.
+    filter.minArea        = 500;
+    filter.maxArea        = 4000;
+    filter.minAspectRatio = 0.5;
+    filter.maxAspectRatio = 2.0;
+
+    for (size_t labelingIndex = 0; labelingIndex < sizeof(labeling) / sizeof(labeling[0]); ++labelingIndex)
+    {
+        double extract = MeasureNanoseconds([&]()
+        {
+            Efficient2Pass(maskView, outputImageView, 8, labeling[labelingIndex].mode, NULL, NULL, &workspace);
+        }, 1, 3);
+
+        double filtered = MeasureNanoseconds([&]()
+        {
+            FilterComponent(maskView, outputImageView, filter, &statistics, &intensityView, labeling[labelingIndex].mode, NULL, &workspace);
+        }, 1, 3);
+
+        keptNumber = 0;
+
+        for (size_t index = 0; index < mask.size(); ++index)
+            keptNumber += (outputImage[index] != 0) ? (1) : (0);
+
+        printf("[Component Statistics] %-10s : Efficient2Pass %8.2f ms, FilterComponent with statistics %8.2f ms, %" PRIu32 " components, %" PRIu32 " pixels kept\n",
+               labeling[labelingIndex].name, extract / 1e6, filtered / 1e6, statistics.componentNumber, keptNumber);
+    }
+
+    return 0;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
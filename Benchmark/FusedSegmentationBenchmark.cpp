@@ -0,0 +1,98 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/FusedSegmentation.h"
+#include "Segmentation/Labeling.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +----------------------------------------------< FUNCTION >----------------------------------------------+
+
+// Bright noisy parts on a dark noisy background, the grayscale counterpart of a blob mask.
+static std::vector<byte_t> GeneratePartImage(size_t width, size_t height, size_t blobNumber)
+{
+    std::vector<byte_t>                image = GenerateBlobMask(width, height, blobNumber, 40);
+    std::mt19937                       generator(3);
+    std::uniform_int_distribution<int> noise(0, 40);
+
+    for (size_t index = 0; index < image.size(); ++index)
+        image[index] = static_cast<byte_t>(((image[index] != 0) ? (180) : (30)) + noise(generator));
+
+    return image;
+}
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    static const size_t SIZE[][2] = { { 1920, 1080 }, { 3840, 2160 } };
+
+    int exitCode = 0;
+
+    for (size_t sizeIndex = 0; sizeIndex < sizeof(SIZE) / sizeof(SIZE[0]); ++sizeIndex)
+    {
+        const size_t width  = SIZE[sizeIndex][0];
+        const size_t height = SIZE[sizeIndex][1];
+
+        struct
+        {
+            const char*         name;
+            std::vector<byte_t> image;
+        } input[] = {
+            { "natural", GenerateNaturalImage(width, height) },
+            { "parts",   GeneratePartImage(width, height, 200) }
+        };
+
+        for (size_t inputIndex = 0; inputIndex < sizeof(input) / sizeof(input[0]); ++inputIndex)
+        {
+            std::vector<byte_t> maskImage(width * height);
+            std::vector<byte_t> referenceImage(width * height);
+            std::vector<byte_t> outputImage(width * height);
+            ImageView           inputView     = MakeImageView(input[inputIndex].image.data(), width, height);
+            ImageView           maskView      = MakeImageView(maskImage.data(), width, height);
+            ImageView           referenceView = MakeImageView(referenceImage.data(), width, height);
+            ImageView           outputView    = MakeImageView(outputImage.data(), width, height);
+            LabelingWorkspace   workspace;
+            ComponentStatistics statistics;
+
+            OtsuThresholdSelection(inputView, maskView);
+            Efficient2Pass(maskView, referenceView, 2, LABELING_MODE_UNION_FIND, NULL, NULL, &workspace);
+            FusedSegmentation(THRESHOLD_METHOD_OTSU, inputView, outputView, 2, NULL, NULL, 1, &workspace);
+
+            if (outputImage != referenceImage)
+            {
+                fprintf(stderr, "[Fused Segmentation] %zux%zu %s: output differs from Otsu and Efficient2Pass\n", width, height, input[inputIndex].name);
+                exitCode = 1;
+            }
+
+            // The chained paths write the mask and read it back, one frame each way, on top of their labeling.
+            double unionFind = MeasureNanoseconds([&]()
+            {
+                OtsuThresholdSelection(inputView, maskView);
+                Efficient2Pass(maskView, outputView, 2, LABELING_MODE_UNION_FIND, NULL, NULL, &workspace);
+            }, 1, 3);
+            double runLength = MeasureNanoseconds([&]()
+            {
+                OtsuThresholdSelection(inputView, maskView);
+                Efficient2Pass(maskView, outputView, 2, LABELING_MODE_RUN_LENGTH, NULL, NULL, &workspace);
+            }, 1, 3);
+            double fused     = MeasureNanoseconds([&]() { FusedSegmentation(THRESHOLD_METHOD_OTSU, inputView, outputView, 2, NULL, NULL, 1, &workspace); }, 1, 3);
+            double measured  = MeasureNanoseconds([&]()
+            {
+                FusedSegmentation(THRESHOLD_METHOD_OTSU, inputView, outputView, 2, &statistics, NULL, 1, &workspace);
+            }, 1, 3);
+
+            printf("[Fused Segmentation] %4zux%-4zu %-7s : Otsu + union-find %7.2f ms, Otsu + run-length %7.2f ms, fused %7.2f ms "
+                   "(%4.2fx, %4.2fx), fused with table %7.2f ms, %zu components\n",
+                   width, height, input[inputIndex].name, unionFind / 1e6, runLength / 1e6, fused / 1e6, unionFind / fused, runLength / fused,
+                   measured / 1e6, static_cast<size_t>(statistics.componentNumber));
+        }
+    }
+
+    return exitCode;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
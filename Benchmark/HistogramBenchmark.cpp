@@ -0,0 +1,85 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/Histogram.h"
+
+// +------------------------------------------< GLOBAL VARIABLE >-------------------------------------------+
+
+static const size_t WIDTH  = 3840;
+static const size_t HEIGHT = 2160;
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    static const SimdKernel KERNEL[] = { SIMD_KERNEL_SCALAR, SIMD_KERNEL_SSE2, SIMD_KERNEL_AVX2 };
+
+    struct
+    {
+        const char*         name;
+        std::vector<byte_t> image;
+    }
+    input[] =
+    {
+        { "uniform",  GenerateUniformImage(WIDTH, HEIGHT)  },
+        { "constant", GenerateConstantImage(WIDTH, HEIGHT) },
+        { "natural",  GenerateNaturalImage(WIDTH, HEIGHT)  }
+    };
+
+    uint32_t referenceHistogram[256];
+    uint32_t histogram[256];
+    int      exitCode = 0;
+
+    printf("[Histogram] %zux%zu, detected kernel %s\n", WIDTH, HEIGHT, SimdKernelName(DetectSimdKernel()));
+
+    for (size_t inputIndex = 0; inputIndex < sizeof(input) / sizeof(input[0]); ++inputIndex)
+    {
+        ImageView image = MakeImageView(input[inputIndex].image.data(), WIDTH, HEIGHT);
+
+        memset(referenceHistogram, 0, sizeof(referenceHistogram));
+
+        for (size_t index = 0; index < WIDTH * HEIGHT; ++index)
+            referenceHistogram[input[inputIndex].image[index]]++;
+
+        // Single double histogram, as Otsu and Kapur counted before ComputeHistogram.
+        double legacyNanoseconds = MeasureNanoseconds([&]()
+        {
+            static double legacyHistogram[256];
+
+            memset(legacyHistogram, 0, sizeof(legacyHistogram));
+
+            for (size_t index = 0; index < WIDTH * HEIGHT; ++index)
+                legacyHistogram[input[inputIndex].image[index]]++;
+        }, 10);
+
+        printf("[Histogram] %-8s %-6s : %8.3f ms, %6.2f GB/s\n", input[inputIndex].name, "double",
+               legacyNanoseconds / 1e6, WIDTH * HEIGHT / legacyNanoseconds);
+
+        for (size_t kernelIndex = 0; kernelIndex < sizeof(KERNEL) / sizeof(KERNEL[0]); ++kernelIndex)
+        {
+            if (ResolveSimdKernel(KERNEL[kernelIndex]) != KERNEL[kernelIndex])
+                continue;
+
+            ComputeHistogram(image, histogram, KERNEL[kernelIndex]);
+
+            if (memcmp(histogram, referenceHistogram, sizeof(histogram)) != 0)
+            {
+                fprintf(stderr, "[Histogram] %s kernel miscounts the %s image\n", SimdKernelName(KERNEL[kernelIndex]), input[inputIndex].name);
+                exitCode = 1;
+            }
+
+            double nanoseconds = MeasureNanoseconds([&]() { ComputeHistogram(image, histogram, KERNEL[kernelIndex]); }, 10);
+
+            printf("[Histogram] %-8s %-6s : %8.3f ms, %6.2f GB/s\n", input[inputIndex].name, SimdKernelName(KERNEL[kernelIndex]),
+                   nanoseconds / 1e6, WIDTH * HEIGHT / nanoseconds);
+        }
+    }
+
+    return exitCode;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,152 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cstdio>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/Instrumentation.h"
+#include "Segmentation/Labeling.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +------------------------------------------< GLOBAL VARIABLE >-------------------------------------------+
+
+struct BenchmarkMode
+{
+    const char*  name;
+    LabelingMode labelingMode;
+};
+
+static const BenchmarkMode MODE[] =
+{
+    { "union-find",          LABELING_MODE_UNION_FIND },
+    { "parallel-union-find", LABELING_MODE_PARALLEL_UNION_FIND },
+    { "run-length",          LABELING_MODE_RUN_LENGTH },
+    { "compact-union-find",  LABELING_MODE_COMPACT_UNION_FIND },
+    { "iterative-2pass",     LABELING_MODE_ITERATIVE_2PASS }
+};
+
+// +-------------------------------------< INSTRUMENTATION BENCHMARK >--------------------------------------+
+
+static size_t ScopeNumber(const InstrumentationReport& report)
+{
+    size_t scopeNumber = 0;
+
+    for (int stage = 0; stage < INSTRUMENTATION_STAGE_NUMBER; ++stage)
+        scopeNumber += report.stage[stage].callNumber;
+
+    return scopeNumber;
+}
+
+static void PrintReport(const char* name, const InstrumentationReport& report, size_t pixelNumber)
+{
+    printf("[Instrumentation Benchmark] %s\n", name);
+
+    for (int stage = 0; stage < INSTRUMENTATION_STAGE_NUMBER; ++stage)
+    {
+        const InstrumentationStageReport& stageReport = report.stage[stage];
+
+        if (stageReport.callNumber == 0)
+            continue;
+
+        printf("    %-18s %6llu calls %10.3f ms %8.3f ns/pixel %9.2f MB %8.2f GB/s\n", InstrumentationStageName(static_cast<InstrumentationStage>(stage)),
+               static_cast<unsigned long long>(stageReport.callNumber), stageReport.nanoseconds / 1e6, static_cast<double>(stageReport.nanoseconds) / pixelNumber,
+               stageReport.byteNumber / 1e6, (stageReport.nanoseconds > 0) ? (static_cast<double>(stageReport.byteNumber) / stageReport.nanoseconds) : (0.0));
+    }
+
+    for (int counter = 0; counter < INSTRUMENTATION_COUNTER_NUMBER; ++counter)
+        printf("    %-18s %6llu\n", InstrumentationCounterName(static_cast<InstrumentationCounter>(counter)),
+               static_cast<unsigned long long>(report.counter[counter]));
+}
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+// Usage: InstrumentationBenchmark [trace file]
+int main(int argc, char* argv[])
+{
+    const char*  traceFileName = (argc > 1) ? (argv[1]) : ("InstrumentationTrace.json");
+    const size_t width         = 1920;
+    const size_t height        = 1080;
+    const size_t pixelNumber   = width * height;
+
+    // The iterative mode needs a pass pair per step of the longest label chain, so it gets the small test frame.
+    std::vector<byte_t> naturalImage = GenerateNaturalImage(width, height);
+    std::vector<byte_t> smallImage(303 * 243);
+    std::vector<byte_t> maskImage(pixelNumber);
+    std::vector<byte_t> outputImage(pixelNumber);
+    LabelingWorkspace   workspace;
+
+    if (ReadResourceImage("hand.raw", MakeImageView(smallImage.data(), 303, 243)) == false)
+    {
+        fprintf(stderr, "[Instrumentation Benchmark] Can't read hand.raw\n");
+        return 1;
+    }
+
+    printf("[Instrumentation Benchmark] Stage scopes are %s\n", (InstrumentationEnabled()) ? ("compiled in") : ("compiled out, all counters stay 0"));
+
+    for (size_t modeIndex = 0; modeIndex < sizeof(MODE) / sizeof(MODE[0]); ++modeIndex)
+    {
+        const bool   small       = (MODE[modeIndex].labelingMode == LABELING_MODE_ITERATIVE_2PASS);
+        const size_t frameWidth  = (small) ? (303) : (width);
+        const size_t frameHeight = (small) ? (243) : (height);
+
+        ImageView inputView  = MakeImageView((small) ? (smallImage.data()) : (naturalImage.data()), frameWidth, frameHeight);
+        ImageView maskView   = MakeImageView(maskImage.data(), frameWidth, frameHeight);
+        ImageView outputView = MakeImageView(outputImage.data(), frameWidth, frameHeight);
+
+        auto frame = [&]()
+        {
+            OtsuThresholdSelection(inputView, maskView);
+            Efficient2Pass(maskView, outputView, 2, MODE[modeIndex].labelingMode, NULL, NULL, &workspace);
+        };
+
+        // Warm the workspace, then report one frame on its own.
+        frame();
+        ResetInstrumentation();
+        frame();
+
+        InstrumentationReport report      = ReadInstrumentation();
+        double                nanoseconds = MeasureNanoseconds(frame, (small) ? (20) : (5), 3);
+
+        PrintReport(MODE[modeIndex].name, report, frameWidth * frameHeight);
+        printf("    %-18s %10.3f ms per frame, %zu scopes\n", "frame", nanoseconds / 1e6, ScopeNumber(report));
+    }
+
+    // A scope costs two clock reads and a few thread-local additions whatever it times, so the cost of an empty
+    // one bounds the overhead per frame.
+    if (InstrumentationEnabled())
+    {
+        const size_t scopeNumber = 1000000;
+
+        double nanoseconds = MeasureNanoseconds([&]()
+        {
+            for (size_t scopeIndex = 0; scopeIndex < scopeNumber; ++scopeIndex)
+                InstrumentationScope scope(INSTRUMENTATION_STAGE_HISTOGRAM, 0, 0);
+        }, 1, 3);
+
+        printf("[Instrumentation Benchmark] %.1f ns per scope\n", nanoseconds / scopeNumber);
+    }
+
+    ImageView inputView  = MakeImageView(naturalImage.data(), width, height);
+    ImageView maskView   = MakeImageView(maskImage.data(), width, height);
+    ImageView outputView = MakeImageView(outputImage.data(), width, height);
+
+    StartInstrumentationTrace();
+
+    for (size_t frameIndex = 0; frameIndex < 4; ++frameIndex)
+    {
+        OtsuThresholdSelection(inputView, maskView);
+        Efficient2Pass(maskView, outputView, 2, MODE[frameIndex % 4].labelingMode, NULL, NULL, &workspace);
+    }
+
+    if (StopInstrumentationTrace(traceFileName) == false)
+    {
+        fprintf(stderr, "[Instrumentation Benchmark] Can't write %s\n", traceFileName);
+        return 1;
+    }
+
+    printf("[Instrumentation Benchmark] Trace of 4 frames written to %s\n", traceFileName);
+
+    return 0;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
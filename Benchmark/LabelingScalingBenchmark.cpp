@@ -0,0 +1,78 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/Labeling.h"
+#include "Segmentation/ThreadPool.h"
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    struct
+    {
+        const char* name;
+        size_t      width;
+        size_t      height;
+    }
+    input[] =
+    {
+        { "4K", 3840, 2160 },
+        { "8K", 7680, 4320 }
+    };
+
+    std::vector<size_t> threadNumber;
+    size_t              maxThreadNumber = std::max<size_t>(1, std::thread::hardware_concurrency());
+    int                 exitCode        = 0;
+
+    for (size_t number = 1; number < maxThreadNumber; number *= 2)
+        threadNumber.push_back(number);
+
+    threadNumber.push_back(maxThreadNumber);
+
+    for (size_t inputIndex = 0; inputIndex < sizeof(input) / sizeof(input[0]); ++inputIndex)
+    {
+        const size_t width  = input[inputIndex].width;
+        const size_t height = input[inputIndex].height;
+
+        std::vector<byte_t> mask            = GenerateBlobMask(width, height, width * height / 2000, 40);
+        std::vector<byte_t> referenceImage(width * height);
+        std::vector<byte_t> outputImage(width * height);
+        ImageView           maskView        = MakeImageView(mask.data(), width, height);
+        ImageView           outputImageView = MakeImageView(outputImage.data(), width, height);
+
+        Efficient2Pass(maskView, MakeImageView(referenceImage.data(), width, height), 8, LABELING_MODE_UNION_FIND);
+
+        double serial = MeasureNanoseconds([&]() { Efficient2Pass(maskView, outputImageView, 8, LABELING_MODE_UNION_FIND); }, 1, 3);
+
+        printf("[Labeling Scaling] %s serial      : %8.2f ms\n", input[inputIndex].name, serial / 1e6);
+
+        for (size_t threadIndex = 0; threadIndex < threadNumber.size(); ++threadIndex)
+        {
+            ThreadPool threadPool(threadNumber[threadIndex] - 1);
+
+            Efficient2Pass(maskView, outputImageView, 8, LABELING_MODE_PARALLEL_UNION_FIND, NULL, &threadPool);
+
+            if (outputImage != referenceImage)
+            {
+                fprintf(stderr, "[Labeling Scaling] %s parallel output differs with %zu threads\n", input[inputIndex].name, threadNumber[threadIndex]);
+                exitCode = 1;
+            }
+
+            double parallel = MeasureNanoseconds([&]()
+            {
+                Efficient2Pass(maskView, outputImageView, 8, LABELING_MODE_PARALLEL_UNION_FIND, NULL, &threadPool);
+            }, 1, 3);
+
+            printf("[Labeling Scaling] %s %2zu threads : %8.2f ms, speedup %5.2fx\n",
+                   input[inputIndex].name, threadNumber[threadIndex], parallel / 1e6, serial / parallel);
+        }
+    }
+
+    return exitCode;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,150 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cstdio>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/Binarization.h"
+#include "Segmentation/RawFile.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +------------------------------------------< GLOBAL VARIABLE >-------------------------------------------+
+
+static const size_t WIDTH       = 8192;
+static const size_t HEIGHT      = 8192;
+static const size_t BAND_HEIGHT = 512;
+static const byte_t THRESHOLD   = 72;
+
+static const char*  INPUT_RAW_FILE_NAME  = "MappedRawFileBenchmark_Input.raw";
+static const char*  OUTPUT_RAW_FILE_NAME = "MappedRawFileBenchmark_Output.raw";
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+// Otsu over a whole stitched frame and a fixed threshold band by band, once through fread/fwrite into heap
+// buffers and once in place in mapped files. Files stay in the page cache between rounds, so the timings
+// compare the copies and allocations, not the disk.
+int main(void)
+{
+    std::vector<byte_t> inputImage      = GenerateNaturalImage(WIDTH, HEIGHT);
+    std::vector<byte_t> referenceImage(WIDTH * HEIGHT);
+    std::vector<byte_t> outputImage(WIDTH * HEIGHT);
+    ImageView           inputImageView  = MakeImageView(inputImage.data(), WIDTH, HEIGHT);
+    ImageView           outputImageView = MakeImageView(outputImage.data(), WIDTH, HEIGHT);
+    int                 exitCode        = 0;
+
+    if (WriteRawImage(INPUT_RAW_FILE_NAME, inputImageView) == false)
+    {
+        fprintf(stderr, "[Mapped RAW File] Can't write %s\n", INPUT_RAW_FILE_NAME);
+        return 1;
+    }
+
+    auto freadOtsu = [&]()
+    {
+        std::vector<byte_t> input(WIDTH * HEIGHT);
+        std::vector<byte_t> output(WIDTH * HEIGHT);
+
+        ReadRawImage(INPUT_RAW_FILE_NAME, MakeImageView(input.data(), WIDTH, HEIGHT));
+        OtsuThresholdSelection(MakeImageView(input.data(), WIDTH, HEIGHT), MakeImageView(output.data(), WIDTH, HEIGHT));
+        WriteRawImage(OUTPUT_RAW_FILE_NAME, MakeImageView(output.data(), WIDTH, HEIGHT));
+    };
+
+    auto mappedOtsu = [&]()
+    {
+        MappedRawFile inputFile;
+        MappedRawFile outputFile;
+        ImageView     input;
+        ImageView     output;
+
+        OpenMappedRawFile(&inputFile, INPUT_RAW_FILE_NAME);
+        CreateMappedRawFile(&outputFile, OUTPUT_RAW_FILE_NAME, WIDTH * HEIGHT);
+        MapRawImageRegion(inputFile, WIDTH, 0, 0, WIDTH, HEIGHT, &input);
+        MapRawImageRegion(outputFile, WIDTH, 0, 0, WIDTH, HEIGHT, &output);
+
+        OtsuThresholdSelection(input, output);
+
+        CloseMappedRawFile(&outputFile);
+        CloseMappedRawFile(&inputFile);
+    };
+
+    auto freadBand = [&]()
+    {
+        std::vector<byte_t> input(WIDTH * HEIGHT);
+        std::vector<byte_t> output(WIDTH * HEIGHT);
+
+        ReadRawImage(INPUT_RAW_FILE_NAME, MakeImageView(input.data(), WIDTH, HEIGHT));
+
+        for (size_t top = 0; top < HEIGHT; top += BAND_HEIGHT)
+            BinarizeImage(MakeImageView(input.data() + top * WIDTH, WIDTH, BAND_HEIGHT), MakeImageView(output.data() + top * WIDTH, WIDTH, BAND_HEIGHT), THRESHOLD);
+
+        WriteRawImage(OUTPUT_RAW_FILE_NAME, MakeImageView(output.data(), WIDTH, HEIGHT));
+    };
+
+    // Every band is prefetched one step ahead and released once binarized, so the resident set stays at a few
+    // bands whatever the file size.
+    auto mappedBand = [&]()
+    {
+        MappedRawFile inputFile;
+        MappedRawFile outputFile;
+        ImageView     input;
+        ImageView     output;
+        ImageView     nextInput;
+
+        OpenMappedRawFile(&inputFile, INPUT_RAW_FILE_NAME);
+        CreateMappedRawFile(&outputFile, OUTPUT_RAW_FILE_NAME, WIDTH * HEIGHT);
+
+        for (size_t top = 0; top < HEIGHT; top += BAND_HEIGHT)
+        {
+            MapRawImageRegion(inputFile, WIDTH, 0, top, WIDTH, BAND_HEIGHT, &input);
+            MapRawImageRegion(outputFile, WIDTH, 0, top, WIDTH, BAND_HEIGHT, &output);
+
+            if (MapRawImageRegion(inputFile, WIDTH, 0, top + BAND_HEIGHT, WIDTH, BAND_HEIGHT, &nextInput))
+                PrefetchMappedRawImage(inputFile, nextInput);
+
+            BinarizeImage(input, output, THRESHOLD);
+
+            ReleaseMappedRawImage(inputFile, input);
+            ReleaseMappedRawImage(outputFile, output);
+        }
+
+        CloseMappedRawFile(&outputFile);
+        CloseMappedRawFile(&inputFile);
+    };
+
+    OtsuThresholdSelection(inputImageView, MakeImageView(referenceImage.data(), WIDTH, HEIGHT));
+
+    mappedOtsu();
+
+    if (ReadRawImage(OUTPUT_RAW_FILE_NAME, outputImageView) == false || outputImage != referenceImage)
+    {
+        fprintf(stderr, "[Mapped RAW File] mapped Otsu output differs from the in-memory one\n");
+        exitCode = 1;
+    }
+
+    BinarizeImage(inputImageView, MakeImageView(referenceImage.data(), WIDTH, HEIGHT), THRESHOLD);
+
+    mappedBand();
+
+    if (ReadRawImage(OUTPUT_RAW_FILE_NAME, outputImageView) == false || outputImage != referenceImage)
+    {
+        fprintf(stderr, "[Mapped RAW File] mapped band output differs from the in-memory one\n");
+        exitCode = 1;
+    }
+
+    double freadOtsuTime  = MeasureNanoseconds(freadOtsu, 1, 3);
+    double mappedOtsuTime = MeasureNanoseconds(mappedOtsu, 1, 3);
+    double freadBandTime  = MeasureNanoseconds(freadBand, 1, 3);
+    double mappedBandTime = MeasureNanoseconds(mappedBand, 1, 3);
+
+    printf("[Mapped RAW File] %zux%zu frame, %.1f MB\n", WIDTH, HEIGHT, WIDTH * HEIGHT / 1e6);
+    printf("[Mapped RAW File] Otsu                 : fread %8.2f ms, mapped %8.2f ms, speedup %5.2fx\n",
+           freadOtsuTime / 1e6, mappedOtsuTime / 1e6, freadOtsuTime / mappedOtsuTime);
+    printf("[Mapped RAW File] %4zu-row bands       : fread %8.2f ms, mapped %8.2f ms, speedup %5.2fx\n",
+           BAND_HEIGHT, freadBandTime / 1e6, mappedBandTime / 1e6, freadBandTime / mappedBandTime);
+
+    remove(INPUT_RAW_FILE_NAME);
+    remove(OUTPUT_RAW_FILE_NAME);
+
+    return exitCode;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,106 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +------------------------------------------< GLOBAL VARIABLE >-------------------------------------------+
+
+static const size_t HAND_WIDTH  = 303;
+static const size_t HAND_HEIGHT = 243;
+
+static volatile byte_t sink;
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    static const ThresholdMethod METHOD[]      = { THRESHOLD_METHOD_OTSU, THRESHOLD_METHOD_KAPUR };
+    static const char*           METHOD_NAME[] = { "Otsu ", "Kapur" };
+
+    std::vector<byte_t> handImage(HAND_WIDTH * HAND_HEIGHT);
+    std::mt19937        generator(303243);
+    double              histogram[256]          = { 0.0 };
+    double              randomHistogram[256]    = { 0.0 };
+    byte_t              threshold[MAX_MULTI_LEVEL_THRESHOLD_NUMBER];
+    byte_t              naiveThreshold[MAX_MULTI_LEVEL_THRESHOLD_NUMBER];
+    int                 exitCode                = 0;
+
+    if (ReadResourceImage("hand.raw", MakeImageView(handImage.data(), HAND_WIDTH, HAND_HEIGHT)) == false)
+    {
+        fprintf(stderr, "[Multi-Level Threshold] Can't read hand.raw\n");
+        return 1;
+    }
+
+    for (size_t index = 0; index < handImage.size(); ++index)
+        histogram[handImage[index]]++;
+
+    for (int methodIndex = 0; methodIndex < 2; ++methodIndex)
+    {
+        ThresholdMethod method = METHOD[methodIndex];
+
+        // A single threshold must agree with the single threshold search.
+        MultiLevelThresholdSearch(method, histogram, 1, threshold);
+
+        if (threshold[0] != ((method == THRESHOLD_METHOD_OTSU) ? (PrefixSumOtsuThresholdSearch(histogram)) : (PrefixSumKapurThresholdSearch(histogram))))
+        {
+            fprintf(stderr, "[Multi-Level Threshold] %s single threshold mismatch\n", METHOD_NAME[methodIndex]);
+            exitCode = 1;
+        }
+
+        for (uint32_t thresholdNumber = 2; thresholdNumber <= 4; ++thresholdNumber)
+        {
+            unsigned int randomMismatch = 0;
+
+            MultiLevelThresholdSearch(method, histogram, thresholdNumber, threshold);
+            MultiLevelThresholdSearch(method, histogram, thresholdNumber, naiveThreshold, THRESHOLD_SEARCH_MODE_EXHAUSTIVE);
+
+            if (memcmp(threshold, naiveThreshold, thresholdNumber) != 0)
+            {
+                fprintf(stderr, "[Multi-Level Threshold] %s k=%u hand.raw mismatch\n", METHOD_NAME[methodIndex], thresholdNumber);
+                exitCode = 1;
+            }
+
+            // Sparse random histograms produce ties between the searches; differences must stay rare.
+            for (int trial = 0; thresholdNumber < 4 && trial < 20; ++trial)
+            {
+                byte_t randomThreshold[MAX_MULTI_LEVEL_THRESHOLD_NUMBER];
+                byte_t randomNaiveThreshold[MAX_MULTI_LEVEL_THRESHOLD_NUMBER];
+
+                for (int brightness = 0; brightness < 256; ++brightness)
+                    randomHistogram[brightness] = (generator() % 4 == 0) ? (0.0) : (static_cast<double>(generator() % 1000));
+
+                MultiLevelThresholdSearch(method, randomHistogram, thresholdNumber, randomThreshold);
+                MultiLevelThresholdSearch(method, randomHistogram, thresholdNumber, randomNaiveThreshold, THRESHOLD_SEARCH_MODE_EXHAUSTIVE);
+
+                randomMismatch += (memcmp(randomThreshold, randomNaiveThreshold, thresholdNumber) != 0) ? (1) : (0);
+            }
+
+            double dynamic = MeasureNanoseconds([&]() { MultiLevelThresholdSearch(method, histogram, thresholdNumber, threshold); sink = threshold[0]; }, 20);
+            double naive   = MeasureNanoseconds([&]()
+            {
+                MultiLevelThresholdSearch(method, histogram, thresholdNumber, naiveThreshold, THRESHOLD_SEARCH_MODE_EXHAUSTIVE);
+                sink = naiveThreshold[0];
+            }, 1, (thresholdNumber < 4) ? (3) : (1));
+
+            printf("[Multi-Level Threshold] %s k=%u : thresholds", METHOD_NAME[methodIndex], thresholdNumber);
+
+            for (uint32_t thresholdIndex = 0; thresholdIndex < 4; ++thresholdIndex)
+                if (thresholdIndex < thresholdNumber)
+                    printf(" %3d", threshold[thresholdIndex]);
+                else
+                    printf("    ");
+
+            printf(", naive %10.3f ms, dynamic programming %7.3f ms, speedup %9.1fx, random mismatches %u\n",
+                   naive / 1e6, dynamic / 1e6, naive / dynamic, randomMismatch);
+        }
+    }
+
+    return exitCode;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,179 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/Binarization.h"
+#include "Segmentation/Histogram.h"
+#include "Segmentation/Labeling.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +-----------------------------------------< ALLOCATION COUNTER >-----------------------------------------+
+
+// Every heap allocation of the process goes through these, so a stage's allocation count is the difference of
+// the counters around one call.
+static std::atomic<size_t> allocationNumber(0);
+static std::atomic<size_t> allocatedByte(0);
+
+void* operator new(size_t size)
+{
+    void* pointer = malloc((size > 0) ? (size) : (1));
+
+    if (pointer == NULL)
+        throw std::bad_alloc();
+
+    allocationNumber.fetch_add(1, std::memory_order_relaxed);
+    allocatedByte.fetch_add(size, std::memory_order_relaxed);
+
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept
+{
+    free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    free(pointer);
+}
+
+// +------------------------------------------< GLOBAL VARIABLE >-------------------------------------------+
+
+struct BenchmarkSize
+{
+    const char* name;
+    size_t      width;
+    size_t      height;
+};
+
+typedef std::function<void(const ImageView& input, const ImageView& mask, const ImageView& output)> StageFunction;
+
+struct BenchmarkStage
+{
+    const char*   name;
+    StageFunction function;
+};
+
+static const BenchmarkSize SIZE[] = { { "303x243", 303, 243 }, { "1080p", 1920, 1080 }, { "4K", 3840, 2160 }, { "8K", 7680, 4320 } };
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+// Usage: PipelineBenchmark [JSON file, '-' for stdout] [size count, 1 to 4]
+int main(int argc, char* argv[])
+{
+    const char* jsonFileName = (argc > 1) ? (argv[1]) : ("-");
+    size_t      sizeNumber   = (argc > 2) ? (strtoul(argv[2], NULL, 10)) : (sizeof(SIZE) / sizeof(SIZE[0]));
+
+    FILE*             jsonFile    = (strcmp(jsonFileName, "-") == 0) ? (stdout) : (fopen(jsonFileName, "w"));
+    LabelingWorkspace workspace;
+    uint32_t          histogram[256];
+    bool              firstResult = true;
+
+    if (jsonFile == NULL)
+    {
+        fprintf(stderr, "[Pipeline Benchmark] Can't write %s\n", jsonFileName);
+        return 1;
+    }
+
+    sizeNumber = std::min(std::max<size_t>(sizeNumber, 1), sizeof(SIZE) / sizeof(SIZE[0]));
+
+    // Stages take the grayscale frame, its Otsu mask and an output frame. The labeling stages share one
+    // workspace, so after the warm-up call they run without heap allocations.
+    std::vector<BenchmarkStage> stage = {
+        { "histogram",           [&](const ImageView& input, const ImageView&, const ImageView&) { ComputeHistogram(input, histogram); } },
+        { "binarize",            [&](const ImageView& input, const ImageView&, const ImageView& output) { BinarizeImage(input, output, 128); } },
+        { "otsu",                [&](const ImageView& input, const ImageView&, const ImageView& output) { OtsuThresholdSelection(input, output); } },
+        { "kapur",               [&](const ImageView& input, const ImageView&, const ImageView& output) { KapurThresholdSelection(input, output); } },
+        { "iterative",           [&](const ImageView& input, const ImageView&, const ImageView& output) { IterativeThresholdSelection(input, output); } },
+        { "union-find",          [&](const ImageView&, const ImageView& mask, const ImageView& output)
+                                 { Efficient2Pass(mask, output, 2, LABELING_MODE_UNION_FIND, NULL, NULL, &workspace); } },
+        { "parallel-union-find", [&](const ImageView&, const ImageView& mask, const ImageView& output)
+                                 { Efficient2Pass(mask, output, 2, LABELING_MODE_PARALLEL_UNION_FIND, NULL, NULL, &workspace); } },
+        { "run-length",          [&](const ImageView&, const ImageView& mask, const ImageView& output)
+                                 { Efficient2Pass(mask, output, 2, LABELING_MODE_RUN_LENGTH, NULL, NULL, &workspace); } },
+        { "compact-union-find",  [&](const ImageView&, const ImageView& mask, const ImageView& output)
+                                 { Efficient2Pass(mask, output, 2, LABELING_MODE_COMPACT_UNION_FIND, NULL, NULL, &workspace); } }
+    };
+
+    fprintf(jsonFile, "{\n  \"benchmark\": \"PipelineBenchmark\",\n  \"threadNumber\": %zu,\n  \"results\": [", DefaultThreadPool().ThreadNumber());
+
+    for (size_t sizeIndex = 0; sizeIndex < sizeNumber; ++sizeIndex)
+    {
+        const size_t width        = SIZE[sizeIndex].width;
+        const size_t height       = SIZE[sizeIndex].height;
+        const size_t pixelNumber  = width * height;
+        const size_t repeatNumber = std::max<size_t>(1, 5000000 / pixelNumber);
+
+        struct
+        {
+            const char*         name;
+            std::vector<byte_t> image;
+        } input[] = {
+            { "natural",      GenerateNaturalImage(width, height) },
+            { "spiral",       GenerateSpiralMask(width, height) },
+            { "checkerboard", GenerateCheckerboardMask(width, height, 8) },
+            { "noise",        GenerateUniformImage(width, height) },
+            { "all-zero",     GenerateConstantImage(width, height, 0) },
+            { "all-255",      GenerateConstantImage(width, height, 255) }
+        };
+
+        std::vector<byte_t> maskImage(pixelNumber);
+        std::vector<byte_t> outputImage(pixelNumber);
+        ImageView           maskView   = MakeImageView(maskImage.data(), width, height);
+        ImageView           outputView = MakeImageView(outputImage.data(), width, height);
+
+        for (size_t inputIndex = 0; inputIndex < sizeof(input) / sizeof(input[0]); ++inputIndex)
+        {
+            ImageView inputView = MakeImageView(input[inputIndex].image.data(), width, height);
+
+            OtsuThresholdSelection(inputView, maskView);
+
+            for (size_t stageIndex = 0; stageIndex < stage.size(); ++stageIndex)
+            {
+                const BenchmarkStage& benchmarkStage = stage[stageIndex];
+
+                // The first call may grow the workspace, the second one shows the steady state of a stream.
+                size_t coldAllocationNumber = allocationNumber.load();
+
+                benchmarkStage.function(inputView, maskView, outputView);
+
+                size_t firstAllocationNumber = allocationNumber.load();
+                size_t firstAllocatedByte    = allocatedByte.load();
+
+                benchmarkStage.function(inputView, maskView, outputView);
+
+                size_t stageAllocationNumber = allocationNumber.load() - firstAllocationNumber;
+                size_t stageAllocatedByte    = allocatedByte.load() - firstAllocatedByte;
+                double nanoseconds           = MeasureNanoseconds([&]() { benchmarkStage.function(inputView, maskView, outputView); },
+                                                                  repeatNumber, 3);
+
+                fprintf(jsonFile, "%s\n    { \"stage\": \"%s\", \"input\": \"%s\", \"size\": \"%s\", \"width\": %zu, \"height\": %zu, "
+                        "\"nanoseconds\": %.0f, \"nanosecondsPerPixel\": %.4f, \"megapixelsPerSecond\": %.2f, "
+                        "\"coldAllocationNumber\": %zu, \"allocationNumber\": %zu, \"allocatedBytes\": %zu }", (firstResult) ? ("") : (","),
+                        benchmarkStage.name, input[inputIndex].name, SIZE[sizeIndex].name, width, height, nanoseconds, nanoseconds / pixelNumber,
+                        pixelNumber / nanoseconds * 1e3, firstAllocationNumber - coldAllocationNumber, stageAllocationNumber, stageAllocatedByte);
+
+                firstResult = false;
+            }
+
+            fprintf(stderr, "[Pipeline Benchmark] %s %s done\n", SIZE[sizeIndex].name, input[inputIndex].name);
+        }
+    }
+
+    fprintf(jsonFile, "\n  ]\n}\n");
+
+    if (jsonFile != stdout)
+        fclose(jsonFile);
+
+    return 0;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
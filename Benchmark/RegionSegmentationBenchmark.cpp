@@ -0,0 +1,78 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cstdio>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/FusedSegmentation.h"
+#include "Segmentation/Labeling.h"
+#include "Segmentation/RegionSegmentation.h"
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    static const size_t SIZE[][2]    = { { 1920, 1080 }, { 3840, 2160 } };
+    static const size_t FRAME_NUMBER = 16;
+
+    int exitCode = 0;
+
+    for (size_t sizeIndex = 0; sizeIndex < sizeof(SIZE) / sizeof(SIZE[0]); ++sizeIndex)
+    {
+        const size_t width  = SIZE[sizeIndex][0];
+        const size_t height = SIZE[sizeIndex][1];
+
+        std::vector<std::vector<byte_t>> inputImage;
+        std::vector<byte_t>              outputImage(width * height);
+        std::vector<byte_t>              referenceImage(width * height);
+        ImageView                        outputView    = MakeImageView(outputImage.data(), width, height);
+        ImageView                        referenceView = MakeImageView(referenceImage.data(), width, height);
+        LabelingWorkspace                workspace;
+        RegionTracker                    tracker;
+        size_t                           mismatchNumber = 0;
+
+        // A few small parts drifting over a large frame, the case region tracking is for.
+        for (size_t frameIndex = 0; frameIndex < FRAME_NUMBER; ++frameIndex)
+            inputImage.push_back(GenerateMovingDiskFrame(width, height, 3, 40, frameIndex));
+
+        InitRegionTracker(&tracker, THRESHOLD_METHOD_OTSU, 2);
+
+        for (size_t frameIndex = 0; frameIndex < FRAME_NUMBER; ++frameIndex)
+        {
+            ImageView inputView = MakeImageView(inputImage[frameIndex].data(), width, height);
+
+            TrackRegionSegmentation(&tracker, inputView, outputView, &workspace);
+            FusedSegmentation(THRESHOLD_METHOD_OTSU, inputView, referenceView, 2, NULL, NULL, 1, &workspace);
+
+            mismatchNumber += (outputImage != referenceImage) ? (1) : (0);
+        }
+
+        if (mismatchNumber > 0)
+        {
+            fprintf(stderr, "[Region Segmentation] %zux%zu: %zu tracked frames differ from the full-frame pass\n", width, height, mismatchNumber);
+            exitCode = 1;
+        }
+
+        double fullFrame = MeasureNanoseconds([&]()
+        {
+            for (size_t frameIndex = 0; frameIndex < FRAME_NUMBER; ++frameIndex)
+                FusedSegmentation(THRESHOLD_METHOD_OTSU, MakeImageView(inputImage[frameIndex].data(), width, height), outputView, 2, NULL, NULL, 1,
+                                  &workspace);
+        }, 1, 3) / FRAME_NUMBER;
+        double tracked   = MeasureNanoseconds([&]()
+        {
+            InitRegionTracker(&tracker, THRESHOLD_METHOD_OTSU, 2);
+
+            for (size_t frameIndex = 0; frameIndex < FRAME_NUMBER; ++frameIndex)
+                TrackRegionSegmentation(&tracker, MakeImageView(inputImage[frameIndex].data(), width, height), outputView, &workspace);
+        }, 1, 3) / FRAME_NUMBER;
+
+        // The first frame of the stream always takes a full-frame pass, the remaining ones the regions.
+        printf("[Region Segmentation] %4zux%-4zu : full frame %7.3f ms, tracked regions %7.3f ms (%5.2fx), %zu of %zu frames in full, %zu lost\n",
+               width, height, fullFrame / 1e6, tracked / 1e6, fullFrame / tracked, tracker.fullFrameNumber, tracker.frameNumber, tracker.lostNumber);
+    }
+
+    return exitCode;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,520 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/Binarization.h"
+#include "Segmentation/BitMask.h"
+#include "Segmentation/ComponentStatistics.h"
+#include "Segmentation/FusedSegmentation.h"
+#include "Segmentation/Histogram.h"
+#include "Segmentation/Labeling.h"
+#include "Segmentation/RegionSegmentation.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +------------------------------------------< GLOBAL VARIABLE >-------------------------------------------+
+
+static const size_t HAND_WIDTH  = 303;
+static const size_t HAND_HEIGHT = 243;
+
+static const LabelingMode LABELING_MODE[]      = { LABELING_MODE_ITERATIVE_2PASS, LABELING_MODE_UNION_FIND, LABELING_MODE_PARALLEL_UNION_FIND,
+                                                   LABELING_MODE_RUN_LENGTH, LABELING_MODE_COMPACT_UNION_FIND };
+static const char*        LABELING_MODE_NAME[] = { "iterative 2-pass", "union-find", "parallel union-find", "run-length", "compact union-find" };
+
+struct StressFrame
+{
+    std::string         name;
+    size_t              width;
+    size_t              height;
+    std::vector<byte_t> image;
+};
+
+static size_t checkNumber   = 0;
+static size_t failureNumber = 0;
+
+// +----------------------------------------------< FUNCTION >----------------------------------------------+
+
+static void Check(bool passed, const std::string& frameName, const char* checkName)
+{
+    ++checkNumber;
+
+    if (passed == false)
+    {
+        ++failureNumber;
+        fprintf(stderr, "[Regression] FAILED %s : %s\n", frameName.c_str(), checkName);
+    }
+}
+
+static bool IsBinarizedWith(const std::vector<byte_t>& inputImage, const std::vector<byte_t>& outputImage, byte_t threshold)
+{
+    for (size_t index = 0; index < inputImage.size(); ++index)
+        if (outputImage[index] != ((inputImage[index] < threshold) ? (0) : (255)))
+            return false;
+
+    return true;
+}
+
+// 3x3 erosion (minimum) or dilation (maximum) of a 0/255 mask, skipping the pixels outside the frame.
+static std::vector<byte_t> ReferenceMorphology(const std::vector<byte_t>& maskImage, size_t width, size_t height, bool erosion)
+{
+    std::vector<byte_t> outputImage(width * height);
+
+    for (size_t iy = 0; iy < height; ++iy)
+    {
+        for (size_t ix = 0; ix < width; ++ix)
+        {
+            byte_t value = (erosion == true) ? (255) : (0);
+
+            for (size_t ny = (iy > 0) ? (iy - 1) : (0); ny <= std::min(iy + 1, height - 1); ++ny)
+                for (size_t nx = (ix > 0) ? (ix - 1) : (0); nx <= std::min(ix + 1, width - 1); ++nx)
+                    value = (erosion == true) ? (std::min(value, maskImage[ny * width + nx])) : (std::max(value, maskImage[ny * width + nx]));
+
+            outputImage[iy * width + ix] = value;
+        }
+    }
+
+    return outputImage;
+}
+
+static std::vector<StressFrame> GenerateStressFrame(void)
+{
+    static const size_t SIZE[][2] = { { 303, 243 }, { 64, 48 }, { 1021, 17 } };
+
+    std::vector<StressFrame> frame;
+
+    for (size_t sizeIndex = 0; sizeIndex < sizeof(SIZE) / sizeof(SIZE[0]); ++sizeIndex)
+    {
+        const size_t width  = SIZE[sizeIndex][0];
+        const size_t height = SIZE[sizeIndex][1];
+        char         name[64];
+
+        struct
+        {
+            const char*         kind;
+            std::vector<byte_t> image;
+        } pattern[] = {
+            { "natural",       GenerateNaturalImage(width, height) },
+            { "noise",         GenerateUniformImage(width, height, static_cast<uint32_t>(sizeIndex + 1)) },
+            { "spiral",        GenerateSpiralMask(width, height) },
+            { "checkerboard1", GenerateCheckerboardMask(width, height, 1) },
+            { "checkerboard8", GenerateCheckerboardMask(width, height, 8) },
+            { "blobs",         GenerateBlobMask(width, height, 40, 12, static_cast<uint32_t>(sizeIndex + 1)) },
+            { "all-zero",      GenerateConstantImage(width, height, 0) },
+            { "all-255",       GenerateConstantImage(width, height, 255) }
+        };
+
+        for (size_t patternIndex = 0; patternIndex < sizeof(pattern) / sizeof(pattern[0]); ++patternIndex)
+        {
+            snprintf(name, sizeof(name), "%s %zux%zu", pattern[patternIndex].kind, width, height);
+            frame.push_back({ name, width, height, pattern[patternIndex].image });
+        }
+    }
+
+    return frame;
+}
+
+// +-------------------------------------------< GOLDEN OUTPUT >--------------------------------------------+
+
+// Every selector in both search modes must reproduce the shipped masks of hand.raw, and every labeling mode the
+// shipped 2-pass output of the Otsu mask.
+static void CheckGoldenOutput(void)
+{
+    static const char* GOLDEN_NAME[] = { "hand_OtsuThresholdSelection.raw", "hand_KapurThresholdSelection.raw", "hand_IterativeThresholdSelection.raw" };
+
+    const size_t        pixelNumber = HAND_WIDTH * HAND_HEIGHT;
+    std::vector<byte_t> handImage(pixelNumber);
+    std::vector<byte_t> goldenImage(pixelNumber);
+    std::vector<byte_t> outputImage(pixelNumber);
+    ImageView           handView    = MakeImageView(handImage.data(), HAND_WIDTH, HAND_HEIGHT);
+    ImageView           goldenView  = MakeImageView(goldenImage.data(), HAND_WIDTH, HAND_HEIGHT);
+    ImageView           outputView  = MakeImageView(outputImage.data(), HAND_WIDTH, HAND_HEIGHT);
+    LabelingWorkspace   workspace;
+
+    if (ReadResourceImage("hand.raw", handView) == false)
+    {
+        Check(false, "hand.raw", "read");
+        return;
+    }
+
+    for (int methodIndex = 0; methodIndex < 3; ++methodIndex)
+    {
+        Check(ReadResourceImage(GOLDEN_NAME[methodIndex], goldenView), GOLDEN_NAME[methodIndex], "read");
+
+        for (int searchMode = THRESHOLD_SEARCH_MODE_EXHAUSTIVE; searchMode <= THRESHOLD_SEARCH_MODE_PREFIX_SUM; ++searchMode)
+        {
+            switch (methodIndex)
+            {
+                case 0:  OtsuThresholdSelection(handView, outputView, static_cast<ThresholdSearchMode>(searchMode));  break;
+                case 1:  KapurThresholdSelection(handView, outputView, static_cast<ThresholdSearchMode>(searchMode)); break;
+                default: IterativeThresholdSelection(handView, outputView);                                           break;
+            }
+
+            Check(outputImage == goldenImage, GOLDEN_NAME[methodIndex],
+                  (searchMode == THRESHOLD_SEARCH_MODE_EXHAUSTIVE) ? ("exhaustive search output") : ("prefix-sum search output"));
+        }
+    }
+
+    Check(ReadResourceImage("hand_OtsuThresholdSelection.raw", handView), "hand_OtsuThresholdSelection.raw", "read");
+    Check(ReadResourceImage("hand_Efficient2Pass.raw", goldenView), "hand_Efficient2Pass.raw", "read");
+
+    for (size_t modeIndex = 0; modeIndex < sizeof(LABELING_MODE) / sizeof(LABELING_MODE[0]); ++modeIndex)
+    {
+        Efficient2Pass(handView, outputView, 2, LABELING_MODE[modeIndex], NULL, NULL, &workspace);
+
+        Check(outputImage == goldenImage, "hand_Efficient2Pass.raw", LABELING_MODE_NAME[modeIndex]);
+    }
+
+    Check(ReadResourceImage("hand.raw", handView), "hand.raw", "read");
+
+    FusedSegmentation(THRESHOLD_METHOD_OTSU, handView, outputView, 2, NULL, NULL, 1, &workspace);
+
+    Check(outputImage == goldenImage, "hand_Efficient2Pass.raw", "fused segmentation");
+
+    static const char* BIT_MASK_FILE_NAME = "RegressionSuite_hand_Efficient2Pass.bits";
+
+    BitMask mask;
+    BitMask readMask;
+    FILE*   file     = NULL;
+    long    fileSize = -1;
+
+    PackBitMask(goldenView, &mask);
+
+    Check(WriteBitMask(BIT_MASK_FILE_NAME, mask) && ReadBitMask(BIT_MASK_FILE_NAME, HAND_WIDTH, HAND_HEIGHT, &readMask), "hand_Efficient2Pass.raw",
+          "bit mask file write and read");
+
+    if ((file = fopen(BIT_MASK_FILE_NAME, "rb")) != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        fileSize = ftell(file);
+        fclose(file);
+    }
+
+    remove(BIT_MASK_FILE_NAME);
+
+    UnpackBitMask(readMask, outputView);
+
+    Check(outputImage == goldenImage && fileSize == static_cast<long>((HAND_WIDTH + 7) / 8 * HAND_HEIGHT), "hand_Efficient2Pass.raw",
+          "bit mask file round trip");
+}
+
+// +--------------------------------------------< STRESS INPUT >--------------------------------------------+
+
+// Without golden files the checks are cross-checks: prefix-sum against exhaustive searches, selector masks
+// against a plain binarization with the returned threshold, and every labeling mode against the original
+// iterative 2-pass engine. Workspaces are shared by all frames to catch state leaking between frames.
+static void CheckStressFrame(const StressFrame& frame, LabelingWorkspace* workspace)
+{
+    const size_t        pixelNumber   = frame.width * frame.height;
+    std::vector<byte_t> inputImage    = frame.image;
+    std::vector<byte_t> maskImage(pixelNumber);
+    std::vector<byte_t> outputImage(pixelNumber);
+    std::vector<byte_t> referenceImage(pixelNumber);
+    ImageView           inputView     = MakeImageView(inputImage.data(), frame.width, frame.height);
+    ImageView           maskView      = MakeImageView(maskImage.data(), frame.width, frame.height);
+    ImageView           outputView    = MakeImageView(outputImage.data(), frame.width, frame.height);
+    ImageView           referenceView = MakeImageView(referenceImage.data(), frame.width, frame.height);
+
+    byte_t otsuThreshold       = OtsuThresholdSelection(inputView, maskView);
+    byte_t exhaustiveThreshold = OtsuThresholdSelection(inputView, outputView, THRESHOLD_SEARCH_MODE_EXHAUSTIVE);
+
+    Check(otsuThreshold == exhaustiveThreshold, frame.name, "Otsu prefix-sum search equals exhaustive search");
+    Check(IsBinarizedWith(inputImage, maskImage, otsuThreshold), frame.name, "Otsu mask");
+
+    byte_t kapurThreshold = KapurThresholdSelection(inputView, outputView);
+
+    exhaustiveThreshold = KapurThresholdSelection(inputView, referenceView, THRESHOLD_SEARCH_MODE_EXHAUSTIVE);
+
+    // Kapur entropies of the two searches agree up to rounding, which may move a tie by one level.
+    Check(std::abs(kapurThreshold - exhaustiveThreshold) <= 1, frame.name, "Kapur prefix-sum search matches exhaustive search");
+    Check(IsBinarizedWith(inputImage, outputImage, kapurThreshold), frame.name, "Kapur mask");
+
+    byte_t   iterativeThreshold = IterativeThresholdSelection(inputView, outputView);
+    byte_t   seedThreshold      = InitIterativeThresholdSelection(inputView);
+    uint32_t histogram[256]     = { 0 };
+
+    for (size_t index = 0; index < pixelNumber; ++index)
+        histogram[inputImage[index]]++;
+
+    Check(iterativeThreshold == IterativeThresholdSearch(histogram, seedThreshold), frame.name, "iterative search from the frame seed");
+    Check(IsBinarizedWith(inputImage, outputImage, iterativeThreshold), frame.name, "iterative mask");
+
+    for (uint32_t areaExtractNumber = 1; areaExtractNumber <= 5; areaExtractNumber += 2)
+    {
+        Efficient2Pass(maskView, referenceView, areaExtractNumber, LABELING_MODE_ITERATIVE_2PASS);
+
+        for (size_t modeIndex = 1; modeIndex < sizeof(LABELING_MODE) / sizeof(LABELING_MODE[0]); ++modeIndex)
+        {
+            std::string checkName = std::string(LABELING_MODE_NAME[modeIndex]) + " equals iterative 2-pass, K = " + std::to_string(areaExtractNumber);
+
+            Efficient2Pass(maskView, outputView, areaExtractNumber, LABELING_MODE[modeIndex], NULL, NULL, workspace);
+
+            Check(outputImage == referenceImage, frame.name, checkName.c_str());
+        }
+    }
+}
+
+// The fused pipeline must write what each selector followed by Efficient2Pass writes, in place as well, and
+// measure the components FilterComponent measures on the selector's mask.
+static void CheckFusedSegmentation(const StressFrame& frame, LabelingWorkspace* workspace)
+{
+    static const char* METHOD_NAME[] = { "Otsu", "Kapur", "iterative" };
+
+    const size_t          pixelNumber   = frame.width * frame.height;
+    std::vector<byte_t>   inputImage    = frame.image;
+    std::vector<byte_t>   maskImage(pixelNumber);
+    std::vector<byte_t>   outputImage(pixelNumber);
+    std::vector<byte_t>   referenceImage(pixelNumber);
+    std::vector<uint32_t> extractedComponent(5);
+    ImageView             inputView     = MakeImageView(inputImage.data(), frame.width, frame.height);
+    ImageView             maskView      = MakeImageView(maskImage.data(), frame.width, frame.height);
+    ImageView             outputView    = MakeImageView(outputImage.data(), frame.width, frame.height);
+    ImageView             referenceView = MakeImageView(referenceImage.data(), frame.width, frame.height);
+    ComponentStatistics   statistics;
+    ComponentStatistics   referenceStatistics;
+
+    for (int method = THRESHOLD_METHOD_OTSU; method <= THRESHOLD_METHOD_ITERATIVE; ++method)
+    {
+        ThresholdMethod thresholdMethod = static_cast<ThresholdMethod>(method);
+        std::string     methodName      = std::string("fused ") + METHOD_NAME[method];
+        byte_t          threshold       = 0;
+
+        switch (thresholdMethod)
+        {
+            case THRESHOLD_METHOD_OTSU:  threshold = OtsuThresholdSelection(inputView, maskView);      break;
+            case THRESHOLD_METHOD_KAPUR: threshold = KapurThresholdSelection(inputView, maskView);     break;
+            default:                     threshold = IterativeThresholdSelection(inputView, maskView); break;
+        }
+
+        for (uint32_t areaExtractNumber = 1; areaExtractNumber <= 5; areaExtractNumber += 2)
+        {
+            std::string checkName = methodName + " equals selector and 2-pass, K = " + std::to_string(areaExtractNumber);
+
+            Efficient2Pass(maskView, referenceView, areaExtractNumber, LABELING_MODE_UNION_FIND, NULL, NULL, workspace);
+
+            Check(FusedSegmentation(thresholdMethod, inputView, outputView, areaExtractNumber, &statistics, extractedComponent.data(), 1, workspace) == threshold &&
+                  outputImage == referenceImage, frame.name, checkName.c_str());
+            Check(std::equal(extractedComponent.begin(), extractedComponent.begin() + areaExtractNumber, workspace->extractedLabel.begin()),
+                  frame.name, (methodName + " extracted components").c_str());
+        }
+
+        FilterComponent(maskView, referenceView, MakeComponentFilter(), &referenceStatistics, &inputView, LABELING_MODE_UNION_FIND, NULL, workspace);
+
+        Check(statistics.componentNumber == referenceStatistics.componentNumber && statistics.area == referenceStatistics.area &&
+              statistics.left == referenceStatistics.left && statistics.top == referenceStatistics.top && statistics.right == referenceStatistics.right &&
+              statistics.bottom == referenceStatistics.bottom && statistics.sumIntensity == referenceStatistics.sumIntensity,
+              frame.name, (methodName + " component table").c_str());
+
+        Efficient2Pass(maskView, referenceView, 2, LABELING_MODE_UNION_FIND, NULL, NULL, workspace);
+        FusedSegmentation(thresholdMethod, inputView, inputView, 2, &statistics, NULL, 1, workspace);
+
+        Check(inputImage == referenceImage && statistics.sumIntensity == referenceStatistics.sumIntensity, frame.name, (methodName + " in place").c_str());
+
+        inputImage = frame.image;
+    }
+}
+
+// The region pipeline must write what Efficient2Pass writes for the mask binarized at its threshold with the
+// outside of the normalized regions cleared, and a single region must get the threshold of its crop.
+static void CheckRegionSegmentation(const StressFrame& frame, LabelingWorkspace* workspace)
+{
+    static const char* METHOD_NAME[] = { "Otsu", "Kapur", "iterative" };
+
+    if (frame.width < 3 || frame.height < 3)
+        return;
+
+    const size_t             width         = frame.width;
+    const size_t             height        = frame.height;
+    const ImageRegion        region[]      = { MakeImageRegion(width / 8, height / 8, width / 3, height / 2),
+                                               MakeImageRegion(width / 2, height / 3, width / 4, height / 3),
+                                               MakeImageRegion(width / 2 + width / 4 + 1, height / 3, 1, 1),
+                                               MakeImageRegion(width - 5, height - 4, 10, 10),
+                                               MakeImageRegion(0, 0, 2, 1),
+                                               MakeImageRegion(width, 0, 4, 4) };
+    std::vector<byte_t>      inputImage    = frame.image;
+    std::vector<byte_t>      maskImage(width * height);
+    std::vector<byte_t>      outputImage(width * height);
+    std::vector<byte_t>      referenceImage(width * height);
+    std::vector<uint32_t>    extractedComponent(3);
+    std::vector<ImageRegion> normalizedRegion;
+    ImageView                inputView     = MakeImageView(inputImage.data(), width, height);
+    ImageView                maskView      = MakeImageView(maskImage.data(), width, height);
+    ImageView                outputView    = MakeImageView(outputImage.data(), width, height);
+    ImageView                referenceView = MakeImageView(referenceImage.data(), width, height);
+    ComponentStatistics      statistics;
+    ComponentStatistics      referenceStatistics;
+
+    NormalizeImageRegion(region, sizeof(region) / sizeof(region[0]), width, height, normalizedRegion);
+
+    for (int method = THRESHOLD_METHOD_OTSU; method <= THRESHOLD_METHOD_ITERATIVE; ++method)
+    {
+        ThresholdMethod thresholdMethod = static_cast<ThresholdMethod>(method);
+        std::string     methodName      = std::string("region ") + METHOD_NAME[method];
+        byte_t          threshold       = RegionSegmentation(thresholdMethod, inputView, outputView, region, sizeof(region) / sizeof(region[0]), 3,
+                                                             &statistics, extractedComponent.data(), workspace);
+
+        std::fill(maskImage.begin(), maskImage.end(), 0);
+
+        for (size_t regionIndex = 0; regionIndex < normalizedRegion.size(); ++regionIndex)
+            BinarizeImage(CropImageView(inputView, normalizedRegion[regionIndex]), CropImageView(maskView, normalizedRegion[regionIndex]), threshold);
+
+        Efficient2Pass(maskView, referenceView, 3, LABELING_MODE_UNION_FIND, NULL, NULL, workspace);
+
+        Check(outputImage == referenceImage && std::equal(extractedComponent.begin(), extractedComponent.end(), workspace->extractedLabel.begin()),
+              frame.name, (methodName + " equals 2-pass of the cleared mask").c_str());
+
+        FilterComponent(maskView, referenceView, MakeComponentFilter(), &referenceStatistics, &inputView, LABELING_MODE_UNION_FIND, NULL, workspace);
+
+        Check(statistics.componentNumber == referenceStatistics.componentNumber && statistics.area == referenceStatistics.area &&
+              statistics.left == referenceStatistics.left && statistics.bottom == referenceStatistics.bottom &&
+              statistics.sumIntensity == referenceStatistics.sumIntensity, frame.name, (methodName + " component table").c_str());
+
+        ImageView cropView = CropImageView(inputView, normalizedRegion[0]);
+        uint32_t  histogram[256];
+
+        ComputeHistogram(cropView, histogram);
+
+        Check(RegionSegmentation(thresholdMethod, inputView, outputView, &normalizedRegion[0], 1, 1, NULL, NULL, workspace) ==
+              SelectThreshold(thresholdMethod, histogram, cropView), frame.name, (methodName + " single region threshold").c_str());
+
+        RegionSegmentation(thresholdMethod, inputView, referenceView, region, sizeof(region) / sizeof(region[0]), 3, NULL, NULL, workspace);
+        RegionSegmentation(thresholdMethod, inputView, inputView, region, sizeof(region) / sizeof(region[0]), 3, NULL, NULL, workspace);
+
+        Check(inputImage == referenceImage, frame.name, (methodName + " in place").c_str());
+
+        inputImage = frame.image;
+    }
+}
+
+// The bit mask path against the 0/255 one: packing and thresholding to bits against BinarizeImage, labeling
+// against Efficient2Pass, and the word-parallel morphology against a per-pixel 3x3 reference.
+static void CheckBitMask(const StressFrame& frame, LabelingWorkspace* workspace)
+{
+    const size_t          width         = frame.width;
+    const size_t          height        = frame.height;
+    std::vector<byte_t>   inputImage    = frame.image;
+    std::vector<byte_t>   maskImage(width * height);
+    std::vector<byte_t>   outputImage(width * height);
+    std::vector<byte_t>   referenceImage(width * height);
+    std::vector<uint32_t> extractedComponent(5);
+    ImageView             inputView     = MakeImageView(inputImage.data(), width, height);
+    ImageView             maskView      = MakeImageView(maskImage.data(), width, height);
+    ImageView             outputView    = MakeImageView(outputImage.data(), width, height);
+    ImageView             referenceView = MakeImageView(referenceImage.data(), width, height);
+    BitMask               mask;
+    BitMask               outputMask;
+    BitMask               temporaryMask;
+    byte_t                threshold     = OtsuThresholdSelection(inputView, maskView);
+
+    PackBitMask(maskView, &mask);
+    ThresholdBitMask(inputView, threshold, &outputMask);
+    UnpackBitMask(mask, outputView);
+
+    Check(outputImage == maskImage && outputMask.word == mask.word, frame.name, "bit mask pack, unpack and threshold");
+
+    for (uint32_t areaExtractNumber = 1; areaExtractNumber <= 5; areaExtractNumber += 2)
+    {
+        std::string checkName = "bit mask 2-pass equals 2-pass, K = " + std::to_string(areaExtractNumber);
+
+        Efficient2Pass(maskView, referenceView, areaExtractNumber, LABELING_MODE_UNION_FIND, NULL, NULL, workspace);
+        BitMaskEfficient2Pass(mask, &outputMask, areaExtractNumber, extractedComponent.data(), workspace);
+        UnpackBitMask(outputMask, outputView);
+
+        Check(outputImage == referenceImage && std::equal(extractedComponent.begin(), extractedComponent.begin() + areaExtractNumber,
+              workspace->extractedLabel.begin()), frame.name, checkName.c_str());
+    }
+
+    outputMask = mask;
+
+    BitMaskEfficient2Pass(outputMask, &outputMask, 3, NULL, workspace);
+    Efficient2Pass(maskView, referenceView, 3, LABELING_MODE_UNION_FIND, NULL, NULL, workspace);
+    UnpackBitMask(outputMask, outputView);
+
+    Check(outputImage == referenceImage, frame.name, "bit mask 2-pass in place");
+
+    std::vector<byte_t> erodedImage  = ReferenceMorphology(maskImage, width, height, true);
+    std::vector<byte_t> dilatedImage = ReferenceMorphology(maskImage, width, height, false);
+
+    ErodeBitMask(mask, &outputMask, &temporaryMask);
+    UnpackBitMask(outputMask, outputView);
+    Check(outputImage == erodedImage, frame.name, "bit mask erosion");
+
+    DilateBitMask(mask, &outputMask);
+    UnpackBitMask(outputMask, outputView);
+    Check(outputImage == dilatedImage, frame.name, "bit mask dilation");
+
+    OpenBitMask(mask, &outputMask, &temporaryMask);
+    UnpackBitMask(outputMask, outputView);
+    Check(outputImage == ReferenceMorphology(erodedImage, width, height, false), frame.name, "bit mask opening");
+
+    outputMask = mask;
+
+    CloseBitMask(outputMask, &outputMask, &temporaryMask);
+    UnpackBitMask(outputMask, outputView);
+    Check(outputImage == ReferenceMorphology(dilatedImage, width, height, true), frame.name, "bit mask closing in place");
+}
+
+// A tracker following moving disks must write what FusedSegmentation writes on every frame, while most frames
+// only process the tracked regions.
+static void CheckRegionTracking(LabelingWorkspace* workspace)
+{
+    const size_t        width  = 320;
+    const size_t        height = 240;
+    std::vector<byte_t> outputImage(width * height);
+    std::vector<byte_t> referenceImage(width * height);
+    ImageView           outputView    = MakeImageView(outputImage.data(), width, height);
+    ImageView           referenceView = MakeImageView(referenceImage.data(), width, height);
+    RegionTracker       tracker;
+    bool                matched       = true;
+
+    InitRegionTracker(&tracker, THRESHOLD_METHOD_OTSU, 2, 16, 25);
+
+    for (size_t frameIndex = 0; frameIndex < 60; ++frameIndex)
+    {
+        std::vector<byte_t> inputImage = GenerateMovingDiskFrame(width, height, 4, 12, frameIndex);
+        ImageView           inputView  = MakeImageView(inputImage.data(), width, height);
+
+        TrackRegionSegmentation(&tracker, inputView, outputView, workspace);
+        FusedSegmentation(THRESHOLD_METHOD_OTSU, inputView, referenceView, 2, NULL, NULL, 1, workspace);
+
+        matched = matched && (outputImage == referenceImage);
+    }
+
+    Check(matched, "moving disks", "tracked regions equal full frames");
+    Check(tracker.frameNumber == 60 && tracker.fullFrameNumber >= 3 && tracker.fullFrameNumber < 10, "moving disks", "region passes used");
+}
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    std::vector<StressFrame> frame = GenerateStressFrame();
+    LabelingWorkspace        workspace;
+
+    CheckGoldenOutput();
+
+    printf("[Regression] golden outputs : %zu checks, %zu failed\n", checkNumber, failureNumber);
+
+    for (size_t frameIndex = 0; frameIndex < frame.size(); ++frameIndex)
+    {
+        size_t previousFailureNumber = failureNumber;
+
+        CheckStressFrame(frame[frameIndex], &workspace);
+        CheckFusedSegmentation(frame[frameIndex], &workspace);
+        CheckRegionSegmentation(frame[frameIndex], &workspace);
+        CheckBitMask(frame[frameIndex], &workspace);
+
+        printf("[Regression] %-22s : %s\n", frame[frameIndex].name.c_str(), (failureNumber == previousFailureNumber) ? ("ok") : ("FAILED"));
+    }
+
+    CheckRegionTracking(&workspace);
+
+    printf("[Regression] %zu checks, %zu failed\n", checkNumber, failureNumber);
+
+    return (failureNumber == 0) ? (0) : (1);
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,84 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/Labeling.h"
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    static const size_t WIDTH  = 3840;
+    static const size_t HEIGHT = 2160;
+
+    // Blob counts from a few hundred thousand to several million foreground pixels.
+    static const size_t BLOB_NUMBER[] = { 500, 5000, 50000 };
+
+    const size_t labelSize = WIDTH * HEIGHT;
+
+    LabelingWorkspace     workspace;
+    std::vector<uint32_t> label(labelSize);
+    std::vector<uint32_t> equivalence(labelSize + 1);
+    std::vector<uint32_t> referenceLabel(labelSize);
+    std::vector<uint32_t> renumberedLabel(labelSize);
+    int                   exitCode = 0;
+
+    for (size_t densityIndex = 0; densityIndex < sizeof(BLOB_NUMBER) / sizeof(BLOB_NUMBER[0]); ++densityIndex)
+    {
+        std::vector<byte_t> mask             = GenerateBlobMask(WIDTH, HEIGHT, BLOB_NUMBER[densityIndex], 40);
+        ImageView           maskView         = MakeImageView(mask.data(), WIDTH, HEIGHT);
+        size_t              foregroundNumber = 0;
+        uint32_t            labelNumber      = static_cast<uint32_t>(labelSize + 1);
+
+        for (size_t index = 0; index < labelSize; ++index)
+            foregroundNumber += (mask[index] != 0) ? (1) : (0);
+
+        UnionFindResolvePass(maskView, label.data(), equivalence.data(), UnionFindLabelPass(maskView, label.data(), equivalence.data()));
+
+        referenceLabel = label;
+        SortingLabelRenumbering(referenceLabel.data(), labelSize, labelNumber, &workspace);
+
+        renumberedLabel = label;
+        LabelRenumbering(renumberedLabel.data(), labelSize, labelNumber, LABEL_ORDER_RASTER, &workspace);
+
+        if (renumberedLabel != referenceLabel)
+        {
+            fprintf(stderr, "[Renumbering] %zu blobs: raster order differs from the sorting renumbering\n", BLOB_NUMBER[densityIndex]);
+            exitCode = 1;
+        }
+
+        // Every round starts from the unnumbered plane, so the copy is timed on its own and taken off.
+        double copy = MeasureNanoseconds([&]()
+        {
+            memcpy(renumberedLabel.data(), label.data(), sizeof(uint32_t) * labelSize);
+        }, 1, 3);
+
+        double sorting = MeasureNanoseconds([&]()
+        {
+            memcpy(renumberedLabel.data(), label.data(), sizeof(uint32_t) * labelSize);
+            SortingLabelRenumbering(renumberedLabel.data(), labelSize, labelNumber, &workspace);
+        }, 1, 3) - copy;
+
+        double raster = MeasureNanoseconds([&]()
+        {
+            memcpy(renumberedLabel.data(), label.data(), sizeof(uint32_t) * labelSize);
+            LabelRenumbering(renumberedLabel.data(), labelSize, labelNumber, LABEL_ORDER_RASTER, &workspace);
+        }, 1, 3) - copy;
+
+        double area = MeasureNanoseconds([&]()
+        {
+            memcpy(renumberedLabel.data(), label.data(), sizeof(uint32_t) * labelSize);
+            LabelRenumbering(renumberedLabel.data(), labelSize, labelNumber, LABEL_ORDER_AREA, &workspace);
+        }, 1, 3) - copy;
+
+        printf("[Renumbering] %8zu foreground pixels : sorting %8.2f ms, raster %7.2f ms (%5.2fx), area %7.2f ms (%5.2fx)\n",
+               foregroundNumber, sorting / 1e6, raster / 1e6, sorting / raster, area / 1e6, sorting / area);
+    }
+
+    return exitCode;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
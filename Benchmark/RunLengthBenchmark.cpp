@@ -0,0 +1,62 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cstdio>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/Labeling.h"
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    static const size_t WIDTH  = 3840;
+    static const size_t HEIGHT = 2160;
+
+    // Blob counts spanning sparse to dense 4K masks.
+    static const size_t BLOB_NUMBER[] = { 50, 500, 5000, 50000 };
+
+    int exitCode = 0;
+
+    for (size_t densityIndex = 0; densityIndex < sizeof(BLOB_NUMBER) / sizeof(BLOB_NUMBER[0]); ++densityIndex)
+    {
+        std::vector<byte_t>   mask             = GenerateBlobMask(WIDTH, HEIGHT, BLOB_NUMBER[densityIndex], 40);
+        std::vector<byte_t>   referenceImage(WIDTH * HEIGHT);
+        std::vector<byte_t>   outputImage(WIDTH * HEIGHT);
+        std::vector<LabelRun> run;
+        std::vector<size_t>   rowRunIndex;
+        ImageView             maskView         = MakeImageView(mask.data(), WIDTH, HEIGHT);
+        ImageView             outputImageView  = MakeImageView(outputImage.data(), WIDTH, HEIGHT);
+        size_t                foregroundNumber = 0;
+
+        for (size_t index = 0; index < mask.size(); ++index)
+            foregroundNumber += (mask[index] != 0) ? (1) : (0);
+
+        EncodeLabelRun(maskView, run, rowRunIndex);
+
+        Efficient2Pass(maskView, MakeImageView(referenceImage.data(), WIDTH, HEIGHT), 8, LABELING_MODE_UNION_FIND);
+        Efficient2Pass(maskView, outputImageView, 8, LABELING_MODE_RUN_LENGTH);
+
+        if (outputImage != referenceImage)
+        {
+            fprintf(stderr, "[Run-Length] %zu blobs: output differs from union-find\n", BLOB_NUMBER[densityIndex]);
+            exitCode = 1;
+        }
+
+        double unionFind = MeasureNanoseconds([&]() { Efficient2Pass(maskView, outputImageView, 8, LABELING_MODE_UNION_FIND); }, 1, 3);
+        double runLength = MeasureNanoseconds([&]() { Efficient2Pass(maskView, outputImageView, 8, LABELING_MODE_RUN_LENGTH); }, 1, 3);
+
+        // Union-find keeps a label plane and an equivalence table per pixel; run-length keeps the runs, two
+        // tables per run and the row index.
+        double unionFindMemory = 2.0 * sizeof(uint32_t) * WIDTH * HEIGHT;
+        double runLengthMemory = (sizeof(LabelRun) + 2.0 * sizeof(uint32_t)) * run.size() + sizeof(size_t) * rowRunIndex.size();
+
+        printf("[Run-Length] %5.1f%% foreground, %8zu runs : union-find %8.2f ms %7.1f MB, run-length %8.2f ms %7.1f MB, speedup %5.2fx\n",
+               100.0 * foregroundNumber / mask.size(), run.size(), unionFind / 1e6, unionFindMemory / 1e6,
+               runLength / 1e6, runLengthMemory / 1e6, unionFind / runLength);
+    }
+
+    return exitCode;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,115 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/Histogram.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +------------------------------------------< GLOBAL VARIABLE >-------------------------------------------+
+
+static const size_t SAMPLE_STRIDE[] = { 1, 2, 4, 8 };
+
+struct BenchmarkFrame
+{
+    std::string         name;
+    size_t              width;
+    size_t              height;
+    std::vector<byte_t> image;
+};
+
+// +----------------------------------------------< FUNCTION >----------------------------------------------+
+
+static byte_t RunSelector(ThresholdMethod method, const ImageView& inputImage, const ImageView& outputImage, size_t sampleStride)
+{
+    switch (method)
+    {
+        case THRESHOLD_METHOD_KAPUR:     return KapurThresholdSelection(inputImage, outputImage, THRESHOLD_SEARCH_MODE_PREFIX_SUM, sampleStride);
+        case THRESHOLD_METHOD_ITERATIVE: return IterativeThresholdSelection(inputImage, outputImage, sampleStride);
+        default:                         return OtsuThresholdSelection(inputImage, outputImage, THRESHOLD_SEARCH_MODE_PREFIX_SUM, sampleStride);
+    }
+}
+
+// Bright parts on a darker belt, both textured, with sensor noise.
+static std::vector<byte_t> GeneratePartImage(size_t width, size_t height)
+{
+    std::vector<byte_t> objectMask = GenerateBlobMask(width, height, 400, 60);
+    std::vector<byte_t> noiseImage = GenerateUniformImage(width, height);
+    std::vector<byte_t> image(width * height);
+
+    for (size_t index = 0; index < width * height; ++index)
+        image[index] = static_cast<byte_t>(((objectMask[index] != 0) ? (150) : (60)) + (noiseImage[index] & 63));
+
+    return image;
+}
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    static const ThresholdMethod METHOD[]      = { THRESHOLD_METHOD_OTSU, THRESHOLD_METHOD_KAPUR, THRESHOLD_METHOD_ITERATIVE };
+    static const char*           METHOD_NAME[] = { "Otsu", "Kapur", "Iterative" };
+
+    std::vector<BenchmarkFrame> frame;
+    uint32_t                    histogram[256];
+
+    frame.push_back({ "hand.raw", 303, 243, std::vector<byte_t>(303 * 243) });
+    frame.push_back({ "natural 4K", 3840, 2160, GenerateNaturalImage(3840, 2160) });
+    frame.push_back({ "parts 4K", 3840, 2160, GeneratePartImage(3840, 2160) });
+    frame.push_back({ "noise 1080p", 1920, 1080, GenerateUniformImage(1920, 1080) });
+
+    if (ReadResourceImage("hand.raw", MakeImageView(frame[0].image.data(), 303, 243)) == false)
+    {
+        fprintf(stderr, "[Sampled Histogram] Can't read hand.raw\n");
+        return 1;
+    }
+
+    for (size_t frameIndex = 0; frameIndex < frame.size(); ++frameIndex)
+    {
+        const size_t        width           = frame[frameIndex].width;
+        const size_t        height          = frame[frameIndex].height;
+        const size_t        repeatNumber    = std::max<size_t>(1, 50000000 / (width * height));
+        std::vector<byte_t> fullImage(width * height);
+        std::vector<byte_t> outputImage(width * height);
+        ImageView           inputImageView  = MakeImageView(frame[frameIndex].image.data(), width, height);
+        ImageView           fullImageView   = MakeImageView(fullImage.data(), width, height);
+        ImageView           outputImageView = MakeImageView(outputImage.data(), width, height);
+
+        printf("[Sampled Histogram] %s (%zux%zu)\n", frame[frameIndex].name.c_str(), width, height);
+
+        double fullHistogram = MeasureNanoseconds([&]() { ComputeHistogram(inputImageView, histogram); }, repeatNumber);
+
+        for (int methodIndex = 0; methodIndex < 3; ++methodIndex)
+        {
+            ThresholdMethod method        = METHOD[methodIndex];
+            byte_t          fullThreshold = RunSelector(method, inputImageView, fullImageView, 1);
+            double          fullSelector  = MeasureNanoseconds([&]() { RunSelector(method, inputImageView, outputImageView, 1); }, repeatNumber);
+
+            for (size_t strideIndex = 1; strideIndex < sizeof(SAMPLE_STRIDE) / sizeof(SAMPLE_STRIDE[0]); ++strideIndex)
+            {
+                const size_t sampleStride = SAMPLE_STRIDE[strideIndex];
+
+                byte_t threshold = RunSelector(method, inputImageView, outputImageView, sampleStride);
+                size_t mismatch  = 0;
+
+                for (size_t index = 0; index < width * height; ++index)
+                    mismatch += (outputImage[index] != fullImage[index]) ? (1) : (0);
+
+                double sampledHistogram = MeasureNanoseconds([&]() { ComputeSampledHistogram(inputImageView, sampleStride, histogram); }, repeatNumber);
+                double sampledSelector  = MeasureNanoseconds([&]() { RunSelector(method, inputImageView, outputImageView, sampleStride); }, repeatNumber);
+
+                printf("[Sampled Histogram]   %-9s stride %zu : threshold %3d (full %3d, deviation %3d, %6.2f %% pixels flipped), "
+                       "histogram %5.1fx, selector %4.2fx faster\n", METHOD_NAME[methodIndex], sampleStride, threshold, fullThreshold,
+                       std::abs(static_cast<int>(threshold) - static_cast<int>(fullThreshold)), 100.0 * mismatch / (width * height),
+                       fullHistogram / sampledHistogram, fullSelector / sampledSelector);
+            }
+        }
+    }
+
+    return 0;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
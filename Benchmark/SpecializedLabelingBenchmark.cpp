@@ -0,0 +1,86 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cstdio>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/Binarization.h"
+#include "Segmentation/Labeling.h"
+#include "Segmentation/LabelingKernel.h"
+
+// +---------------------------------------------< BENCHMARK >----------------------------------------------+
+
+// Times the union-find pass of the serial engine against the kernels of both connectivities, with 32-bit and
+// 16-bit labels, and checks that the 8-connected ones agree with the serial engine.
+static int BenchmarkKernel(const char* frameName, const std::vector<byte_t>& mask, size_t width, size_t height)
+{
+    ImageView             maskView        = MakeImageView(const_cast<byte_t*>(mask.data()), width, height);
+    std::vector<uint32_t> referenceLabel(width * height);
+    std::vector<uint32_t> label(width * height);
+    std::vector<uint32_t> equivalence(width * height + 1);
+    std::vector<uint16_t> compactLabel(width * height);
+    std::vector<uint16_t> compactEquivalence(width * height + 1);
+    uint32_t              compactBound    = 0;
+    int                   exitCode        = 0;
+
+    UnionFindResolvePass(maskView, referenceLabel.data(), equivalence.data(), UnionFindLabelPass(maskView, referenceLabel.data(), equivalence.data()));
+
+    UnionFindLabelKernel<CONNECTIVITY_8, uint32_t>(maskView, label.data(), equivalence.data());
+
+    if (label != referenceLabel)
+    {
+        fprintf(stderr, "[Specialized Labeling] %s: 8-connected kernel differs from the serial engine\n", frameName);
+        exitCode = 1;
+    }
+
+    compactBound = UnionFindLabelKernel<CONNECTIVITY_8, uint16_t>(maskView, compactLabel.data(), compactEquivalence.data());
+
+    if (compactBound != 0 && std::equal(compactLabel.begin(), compactLabel.end(), referenceLabel.begin()) == false)
+    {
+        fprintf(stderr, "[Specialized Labeling] %s: 16-bit kernel differs from the serial engine\n", frameName);
+        exitCode = 1;
+    }
+
+    double serial    = MeasureNanoseconds([&]()
+    {
+        UnionFindResolvePass(maskView, label.data(), equivalence.data(), UnionFindLabelPass(maskView, label.data(), equivalence.data()));
+    }, 5);
+    double kernel8   = MeasureNanoseconds([&]() { UnionFindLabelKernel<CONNECTIVITY_8, uint32_t>(maskView, label.data(), equivalence.data()); }, 5);
+    double kernel4   = MeasureNanoseconds([&]() { UnionFindLabelKernel<CONNECTIVITY_4, uint32_t>(maskView, label.data(), equivalence.data()); }, 5);
+    double compact8  = MeasureNanoseconds([&]()
+    {
+        UnionFindLabelKernel<CONNECTIVITY_8, uint16_t>(maskView, compactLabel.data(), compactEquivalence.data());
+    }, 5);
+
+    printf("[Specialized Labeling] %-22s : serial %7.3f ms, 8-conn kernel %7.3f ms (%4.2fx serial), 16-bit %7.3f ms%s, 4-conn kernel %7.3f ms\n",
+           frameName, serial / 1e6, kernel8 / 1e6, serial / kernel8, compact8 / 1e6, (compactBound == 0) ? (" (overflow)") : (""), kernel4 / 1e6);
+
+    return exitCode;
+}
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    std::vector<byte_t> handMask(303 * 243);
+    std::vector<byte_t> naturalImage = GenerateNaturalImage(1920, 1080);
+    std::vector<byte_t> naturalMask(1920 * 1080);
+    std::vector<byte_t> blobMask     = GenerateBlobMask(1920, 1080, 5000, 12);
+    int                 exitCode     = 0;
+
+    if (ReadResourceImage("hand_OtsuThresholdSelection.raw", MakeImageView(handMask.data(), 303, 243)) == false)
+    {
+        fprintf(stderr, "[Specialized Labeling] Can't read hand_OtsuThresholdSelection.raw\n");
+        return 1;
+    }
+
+    BinarizeImage(MakeImageView(naturalImage.data(), 1920, 1080), MakeImageView(naturalMask.data(), 1920, 1080), 72);
+
+    exitCode |= BenchmarkKernel("303x243 hand", handMask, 303, 243);
+    exitCode |= BenchmarkKernel("1920x1080 natural", naturalMask, 1920, 1080);
+    exitCode |= BenchmarkKernel("1920x1080 5000 blobs", blobMask, 1920, 1080);
+
+    return exitCode;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,63 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/Labeling.h"
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    // A line-scan sized frame: 4096 columns, 100 tiles of 1024 rows each.
+    static const size_t WIDTH       = 4096;
+    static const size_t TILE_HEIGHT = 1024;
+    static const size_t TILE_NUMBER = 100;
+
+    std::vector<byte_t> tile           = GenerateBlobMask(WIDTH, TILE_HEIGHT, 2000, 40);
+    LabelingStream      stream;
+    uint64_t            componentNumber = 0;
+    uint64_t            area            = 0;
+    size_t              maxSlotNumber   = 0;
+    size_t              maxRunNumber    = 0;
+
+    double elapsed = MeasureNanoseconds([&]()
+    {
+        componentNumber = 0;
+        area            = 0;
+
+        InitLabelingStream(&stream, WIDTH);
+
+        ComponentSink componentSink = [&](const StreamComponent& component)
+        {
+            ++componentNumber;
+            area += component.area;
+        };
+
+        for (size_t iy = 0; iy < TILE_HEIGHT * TILE_NUMBER; ++iy)
+        {
+            PushLabelingStreamRow(&stream, tile.data() + (iy % TILE_HEIGHT) * WIDTH, componentSink);
+
+            maxSlotNumber = std::max(maxSlotNumber, stream.component.size());
+            maxRunNumber  = std::max(maxRunNumber, stream.prevRun.size());
+        }
+
+        FinishLabelingStream(&stream, componentSink);
+    }, 1, 3);
+
+    double frameMemory  = static_cast<double>(WIDTH) * TILE_HEIGHT * TILE_NUMBER * (sizeof(byte_t) + 2 * sizeof(uint32_t));
+    double streamMemory = static_cast<double>(maxSlotNumber) * (sizeof(StreamComponent) + sizeof(uint32_t) + sizeof(size_t)) +
+                          2.0 * maxRunNumber * sizeof(LabelRun);
+
+    printf("[Stream Labeling] %zux%zu : %8.2f ms, %6.2f Mrows/s, %" PRIu64 " components, %" PRIu64 " pixels\n",
+           WIDTH, TILE_HEIGHT * TILE_NUMBER, elapsed / 1e6, TILE_HEIGHT * TILE_NUMBER / (elapsed / 1e3), componentNumber, area);
+    printf("[Stream Labeling] peak %zu component slots, %zu runs per row : %.1f KB vs %.1f MB for a full frame\n",
+           maxSlotNumber, maxRunNumber, streamMemory / 1e3, frameMemory / 1e6);
+
+    return 0;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,81 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +------------------------------------------< GLOBAL VARIABLE >-------------------------------------------+
+
+static const size_t HAND_WIDTH           = 303;
+static const size_t HAND_HEIGHT          = 243;
+static const byte_t HAND_OTSU_THRESHOLD  = 72;
+static const byte_t HAND_KAPUR_THRESHOLD = 73;
+
+static volatile byte_t sink;
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    std::vector<byte_t> handImage(HAND_WIDTH * HAND_HEIGHT);
+    std::mt19937        generator(303243);
+    double              histogram[256]  = { 0.0 };
+    int                 exitCode        = 0;
+    unsigned int        kapurMismatch   = 0;
+
+    if (ReadResourceImage("hand.raw", MakeImageView(handImage.data(), HAND_WIDTH, HAND_HEIGHT)) == false)
+    {
+        fprintf(stderr, "[Threshold Search] Can't read hand.raw\n");
+        return 1;
+    }
+
+    for (size_t index = 0; index < handImage.size(); ++index)
+        histogram[handImage[index]]++;
+
+    printf("[Threshold Search] hand.raw Otsu  : exhaustive %3d, prefix-sum %3d\n",
+           ExhaustiveOtsuThresholdSearch(histogram), PrefixSumOtsuThresholdSearch(histogram));
+    printf("[Threshold Search] hand.raw Kapur : exhaustive %3d, prefix-sum %3d\n",
+           ExhaustiveKapurThresholdSearch(histogram), PrefixSumKapurThresholdSearch(histogram));
+
+    if (ExhaustiveOtsuThresholdSearch(histogram)  != HAND_OTSU_THRESHOLD  || PrefixSumOtsuThresholdSearch(histogram)  != HAND_OTSU_THRESHOLD ||
+        ExhaustiveKapurThresholdSearch(histogram) != HAND_KAPUR_THRESHOLD || PrefixSumKapurThresholdSearch(histogram) != HAND_KAPUR_THRESHOLD)
+    {
+        fprintf(stderr, "[Threshold Search] hand.raw threshold mismatch\n");
+        exitCode = 1;
+    }
+
+    double exhaustiveOtsu  = MeasureNanoseconds([&]() { sink = ExhaustiveOtsuThresholdSearch(histogram); }, 2000);
+    double prefixSumOtsu   = MeasureNanoseconds([&]() { sink = PrefixSumOtsuThresholdSearch(histogram); }, 2000);
+    double exhaustiveKapur = MeasureNanoseconds([&]() { sink = ExhaustiveKapurThresholdSearch(histogram); }, 200);
+    double prefixSumKapur  = MeasureNanoseconds([&]() { sink = PrefixSumKapurThresholdSearch(histogram); }, 2000);
+
+    printf("[Threshold Search] Otsu  : exhaustive %10.1f ns, prefix-sum %8.1f ns, speedup %6.1fx\n",
+           exhaustiveOtsu, prefixSumOtsu, exhaustiveOtsu / prefixSumOtsu);
+    printf("[Threshold Search] Kapur : exhaustive %10.1f ns, prefix-sum %8.1f ns, speedup %6.1fx\n",
+           exhaustiveKapur, prefixSumKapur, exhaustiveKapur / prefixSumKapur);
+
+    // Random histograms: Otsu must always agree, Kapur may only differ where two entropies tie up to rounding.
+    for (unsigned int trial = 0; trial < 1000; ++trial)
+    {
+        for (int brightness = 0; brightness < 256; ++brightness)
+            histogram[brightness] = (generator() % 4 == 0) ? (0.0) : (static_cast<double>(generator() % 5000));
+
+        if (ExhaustiveOtsuThresholdSearch(histogram) != PrefixSumOtsuThresholdSearch(histogram))
+        {
+            fprintf(stderr, "[Threshold Search] Otsu mismatch on random histogram %u\n", trial);
+            exitCode = 1;
+        }
+
+        if (ExhaustiveKapurThresholdSearch(histogram) != PrefixSumKapurThresholdSearch(histogram))
+            kapurMismatch++;
+    }
+
+    printf("[Threshold Search] Kapur rounding ties on 1000 random histograms : %u\n", kapurMismatch);
+
+    return exitCode;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
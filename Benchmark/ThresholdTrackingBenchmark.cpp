@@ -0,0 +1,95 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/Histogram.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +------------------------------------------< GLOBAL VARIABLE >-------------------------------------------+
+
+static const size_t WIDTH        = 1920;
+static const size_t HEIGHT       = 1080;
+static const size_t FRAME_NUMBER = 240;
+static const size_t CUT_FRAME    = 160;
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    static const ThresholdMethod METHOD[]      = { THRESHOLD_METHOD_OTSU, THRESHOLD_METHOD_KAPUR, THRESHOLD_METHOD_ITERATIVE };
+    static const char*           METHOD_NAME[] = { "Otsu", "Kapur", "Iterative" };
+
+    std::vector<byte_t> objectMask = GenerateBlobMask(WIDTH, HEIGHT, 150, 60);
+    std::vector<byte_t> noiseImage = GenerateUniformImage(WIDTH, HEIGHT);
+    std::vector<byte_t> baseImage(WIDTH * HEIGHT);
+    std::vector<byte_t> frameImage(WIDTH * HEIGHT);
+    ImageView           frameView  = MakeImageView(frameImage.data(), WIDTH, HEIGHT);
+    ThresholdTracker    tracker[3];
+    double              fullNanoseconds[3]    = { 0.0 };
+    double              trackNanoseconds[3]   = { 0.0 };
+    double              deviationSum[3]       = { 0.0 };
+    int                 maxDeviation[3]       = { 0 };
+    uint32_t            histogram[256];
+    byte_t              brightnessTable[256];
+
+    // Parts on a belt, both textured.
+    for (size_t index = 0; index < WIDTH * HEIGHT; ++index)
+        baseImage[index] = static_cast<byte_t>(((objectMask[index] != 0) ? (150) : (60)) + (noiseImage[index] & 31));
+
+    for (int methodIndex = 0; methodIndex < 3; ++methodIndex)
+        InitThresholdTracker(&tracker[methodIndex], METHOD[methodIndex]);
+
+    printf("[Threshold Tracking] %zux%zu stream of %zu frames, slow lighting drift, scene cut at frame %zu\n", WIDTH, HEIGHT, FRAME_NUMBER, CUT_FRAME);
+
+    for (size_t frameIndex = 0; frameIndex < FRAME_NUMBER; ++frameIndex)
+    {
+        // The lighting drifts by a few percent over the stream and the camera noise changes every frame. At the
+        // cut the scene turns into its negative.
+        double gain = 0.9 + 0.1 * std::sin(frameIndex * 0.02);
+
+        for (int brightness = 0; brightness < 256; ++brightness)
+        {
+            int value = static_cast<int>(brightness * gain + 0.5);
+
+            brightnessTable[brightness] = static_cast<byte_t>((frameIndex < CUT_FRAME) ? (value) : (255 - value));
+        }
+
+        for (size_t index = 0; index < WIDTH * HEIGHT; ++index)
+        {
+            int value = brightnessTable[baseImage[index]] + (noiseImage[(index + frameIndex * 7919) % (WIDTH * HEIGHT)] >> 5) - 4;
+
+            frameImage[index] = static_cast<byte_t>((value < 0) ? (0) : ((value > 255) ? (255) : (value)));
+        }
+
+        for (int methodIndex = 0; methodIndex < 3; ++methodIndex)
+        {
+            std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+            byte_t                                fullThreshold = SelectThreshold(METHOD[methodIndex], ComputeHistogram(frameView, histogram), frameView);
+            std::chrono::steady_clock::time_point middleTime = std::chrono::steady_clock::now();
+            byte_t                                trackedThreshold = TrackThreshold(&tracker[methodIndex], frameView);
+            std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now();
+
+            int deviation = std::abs(static_cast<int>(trackedThreshold) - static_cast<int>(fullThreshold));
+
+            fullNanoseconds[methodIndex]  += std::chrono::duration<double, std::nano>(middleTime - startTime).count();
+            trackNanoseconds[methodIndex] += std::chrono::duration<double, std::nano>(endTime - middleTime).count();
+            deviationSum[methodIndex]     += deviation;
+            maxDeviation[methodIndex]      = std::max(maxDeviation[methodIndex], deviation);
+        }
+    }
+
+    for (int methodIndex = 0; methodIndex < 3; ++methodIndex)
+        printf("[Threshold Tracking] %-9s : full %6.3f ms/frame, tracked %6.3f ms/frame (%5.1fx), %3zu searches, "
+               "deviation mean %5.2f max %3d\n", METHOD_NAME[methodIndex], fullNanoseconds[methodIndex] / FRAME_NUMBER / 1e6,
+               trackNanoseconds[methodIndex] / FRAME_NUMBER / 1e6, fullNanoseconds[methodIndex] / trackNanoseconds[methodIndex],
+               tracker[methodIndex].searchNumber, deviationSum[methodIndex] / FRAME_NUMBER, maxDeviation[methodIndex]);
+
+    return 0;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
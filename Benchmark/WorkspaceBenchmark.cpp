@@ -0,0 +1,134 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+// GCC inlines the replaced operator delete into callers and then mistakes its free() for a mismatched release.
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "Benchmark/Benchmark.h"
+#include "Segmentation/Labeling.h"
+#include "Segmentation/ThreadPool.h"
+
+// +------------------------------------------< GLOBAL VARIABLE >-------------------------------------------+
+
+static const size_t WIDTH        = 1920;
+static const size_t HEIGHT       = 1080;
+static const size_t FRAME_NUMBER = 30;
+
+static std::atomic<size_t> heapAllocationNumber(0);
+
+// +-----------------------------------------< ALLOCATION COUNTER >-----------------------------------------+
+
+// Every heap allocation of the process goes through here, the library's included.
+void* operator new(size_t size)
+{
+    void* pointer = malloc((size != 0) ? (size) : (1));
+
+    if (pointer == NULL)
+        throw std::bad_alloc();
+
+    ++heapAllocationNumber;
+
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept
+{
+    free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    free(pointer);
+}
+
+// +------------------------------------------------< MAIN >------------------------------------------------+
+
+int main(void)
+{
+    struct
+    {
+        const char*  name;
+        LabelingMode mode;
+    }
+    labeling[] =
+    {
+        { "union-find",          LABELING_MODE_UNION_FIND          },
+        { "parallel union-find", LABELING_MODE_PARALLEL_UNION_FIND },
+        { "run-length",          LABELING_MODE_RUN_LENGTH          }
+    };
+
+    std::vector<std::vector<byte_t>> frame;
+    std::vector<std::vector<byte_t>> referenceImage;
+    std::vector<byte_t>              outputImage(WIDTH * HEIGHT);
+    ImageView                        outputImageView = MakeImageView(outputImage.data(), WIDTH, HEIGHT);
+    ThreadPool&                      threadPool      = DefaultThreadPool();
+    int                              exitCode        = 0;
+
+    for (size_t frameIndex = 0; frameIndex < FRAME_NUMBER; ++frameIndex)
+    {
+        frame.push_back(GenerateBlobMask(WIDTH, HEIGHT, 1000, 40, static_cast<uint32_t>(frameIndex + 1)));
+        referenceImage.push_back(std::vector<byte_t>(WIDTH * HEIGHT));
+
+        Efficient2Pass(MakeImageView(frame[frameIndex].data(), WIDTH, HEIGHT), MakeImageView(referenceImage[frameIndex].data(), WIDTH, HEIGHT), 8);
+    }
+
+    for (size_t labelingIndex = 0; labelingIndex < sizeof(labeling) / sizeof(labeling[0]); ++labelingIndex)
+    {
+        for (int useWorkspace = 0; useWorkspace < 2; ++useWorkspace)
+        {
+            LabelingWorkspace  workspace;
+            LabelingWorkspace* workspacePointer     = (useWorkspace != 0) ? (&workspace) : (NULL);
+            size_t             allocationNumber     = 0;
+            size_t             warmAllocationNumber = 0;
+
+            auto processFrame = [&](size_t frameIndex)
+            {
+                Efficient2Pass(MakeImageView(frame[frameIndex].data(), WIDTH, HEIGHT), outputImageView, 8, labeling[labelingIndex].mode,
+                               NULL, &threadPool, workspacePointer);
+            };
+
+            // The first frame sizes the workspace, the following ones should find every buffer large enough.
+            processFrame(0);
+
+            warmAllocationNumber = workspace.allocationNumber;
+
+            for (size_t frameIndex = 0; frameIndex < FRAME_NUMBER; ++frameIndex)
+            {
+                size_t heapStart = heapAllocationNumber;
+
+                processFrame(frameIndex);
+
+                allocationNumber += heapAllocationNumber - heapStart;
+
+                if (outputImage != referenceImage[frameIndex])
+                {
+                    fprintf(stderr, "[Workspace] %s frame %zu differs\n", labeling[labelingIndex].name, frameIndex);
+                    exitCode = 1;
+                }
+            }
+
+            double elapsed = MeasureNanoseconds([&]()
+            {
+                for (size_t frameIndex = 0; frameIndex < FRAME_NUMBER; ++frameIndex)
+                    processFrame(frameIndex);
+            }, 1, 3) / FRAME_NUMBER;
+
+            printf("[Workspace] %-19s %-9s : %7.3f ms per frame, %6.1f heap allocations per frame, %zu workspace growths after the first frame\n",
+                   labeling[labelingIndex].name, (useWorkspace != 0) ? ("workspace") : ("fresh"), elapsed / 1e6,
+                   static_cast<double>(allocationNumber) / FRAME_NUMBER, workspace.allocationNumber - warmAllocationNumber);
+        }
+    }
+
+    return exitCode;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
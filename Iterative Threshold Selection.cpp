@@ -6,128 +6,61 @@
 
 // +----------------------------------------------< INCLUDE >-----------------------------------------------+
 
-#include <cassert>
-#include <cinttypes>
 #include <cstdio>
+#include <cstdlib>
 
-// +------------------------------------------< TYPE DEFINITION >-------------------------------------------+
+#include "Segmentation/RawFile.h"
+#include "Segmentation/ThresholdSelection.h"
 
-typedef uint8_t byte_t;
-
-// +------------------------------------------< GLOBAL VARIABLE >-------------------------------------------+
-
-static const size_t WIDTH  = 303;
-static const size_t HEIGHT = 243;
-
-byte_t* inputImage;
-byte_t* outputImage;
-
-// +-----------------------------------< ITERATIVE THRESHOLD SELECTION >------------------------------------+
-
-byte_t InitIterativeThresholdSelection(byte_t* image)
-{
-    assert(image != NULL);
-
-    double foregroundMean = 0.0;
-    double backgroundMean = 0.0;
-
-    for (int iy = 0; iy < HEIGHT; ++iy)
-        for (int ix = 0; ix < WIDTH; ++ix)
-            foregroundMean += image[iy * WIDTH + ix];
-
-    backgroundMean += image[0] + image[WIDTH - 1] + image[(HEIGHT - 1) * WIDTH] + image[(HEIGHT - 1) * WIDTH + (WIDTH - 1)];
-    foregroundMean -= backgroundMean;
-
-    foregroundMean /= (WIDTH - 2) * (HEIGHT - 2);
-    backgroundMean /= 4.0;
-
-    return static_cast<byte_t>((foregroundMean + backgroundMean) / 2.0 + 0.5);
-}
+// +------------------------------------------------< MAIN >------------------------------------------------+
 
-byte_t ComputeIterativeThresholdSelection(uint32_t* histogram, byte_t threshold)
+int main(int argc, char* argv[])
 {
-    assert(histogram != NULL);
-
-    double   foregroundMean   = 0.0;
-    double   backgroundMean   = 0.0;
-    uint32_t foregroundNumber = 0;
-    uint32_t backgroundNumber = 0;
-
-    for (int brightness = 0; brightness <= threshold; ++brightness)
+    static const char*  INPUT_RAW_FILE_NAME  = "hand.raw";
+    static const char*  OUTPUT_RAW_FILE_NAME = "hand_IterativeThresholdSelection.raw";
+    static const size_t WIDTH                = 303;
+    static const size_t HEIGHT               = 243;
+
+    const char* inputRawFileName  = (argc > 1) ? (argv[1]) : (INPUT_RAW_FILE_NAME);
+    const char* outputRawFileName = (argc > 2) ? (argv[2]) : (OUTPUT_RAW_FILE_NAME);
+    size_t      width             = (argc > 3) ? (strtoul(argv[3], NULL, 10)) : (WIDTH);
+    size_t      height            = (argc > 4) ? (strtoul(argv[4], NULL, 10)) : (HEIGHT);
+    size_t      sampleStride      = (argc > 5) ? (strtoul(argv[5], NULL, 10)) : (1);
+
+    MappedRawFile inputFile;
+    MappedRawFile outputFile;
+    ImageView     inputImageView;
+    ImageView     outputImageView;
+    int           exitCode = 0;
+
+    // Both frames stay in their mapped files, so nothing is copied through stdio buffers.
+    if (OpenMappedRawFile(&inputFile, inputRawFileName) == false ||
+        MapRawImageRegion(inputFile, width, 0, 0, width, height, &inputImageView) == false)
     {
-        foregroundMean   += histogram[brightness] * brightness;
-        foregroundNumber += histogram[brightness];
+        fprintf(stderr, "[Iterative Threshold] Can't read %zux%zu frame from %s\n", width, height, inputRawFileName);
+        exitCode = 1;
     }
-
-    for (int brightness = threshold + 1; brightness < 256; ++brightness)
+    else if (CreateMappedRawFile(&outputFile, outputRawFileName, width * height) == false)
     {
-        backgroundMean   += histogram[brightness] * brightness;
-        backgroundNumber += histogram[brightness];
+        fprintf(stderr, "[Iterative Threshold] Can't write %s\n", outputRawFileName);
+        exitCode = 1;
     }
-
-    foregroundMean /= foregroundNumber;
-    backgroundMean /= backgroundNumber;
-
-    return static_cast<byte_t>((foregroundMean + backgroundMean) / 2.0 + 0.5);
-}
-
-byte_t IterativeThresholdSelection(byte_t* inputImage, byte_t* outputImage)
-{
-    assert(inputImage  != NULL);
-    assert(outputImage != NULL);
-
-    uint32_t histogram[256] = { 0 };
-    byte_t   threshold      = 0;
-    byte_t   prevThreshold  = 0;
-
-    for (int iy = 0; iy < HEIGHT; ++iy)
-        for (int ix = 0; ix < WIDTH; ++ix)
-            histogram[inputImage[iy * WIDTH + ix]]++;
-
-    threshold = InitIterativeThresholdSelection(inputImage);
-
-    while (true)
+    else
     {
-        prevThreshold = threshold;
-        threshold     = ComputeIterativeThresholdSelection(histogram, prevThreshold);
-
-        if (threshold == prevThreshold)
-            break;
-    }
+        MapRawImageRegion(outputFile, width, 0, 0, width, height, &outputImageView);
 
-    for (int iy = 0; iy < HEIGHT; ++iy)
-        for (int ix = 0; ix < WIDTH; ++ix)
-            outputImage[iy * WIDTH + ix] = (inputImage[iy * WIDTH + ix] < threshold) ? (0) : (255);
-
-    return threshold;
-}
+        printf("[Iterative Threshold] %d\n", IterativeThresholdSelection(inputImageView, outputImageView, (sampleStride > 0) ? (sampleStride) : (1)));
 
-// +------------------------------------------------< MAIN >------------------------------------------------+
-
-int main(void)
-{
-    static const char* INPUT_RAW_FILE_NAME  = "hand.raw";
-    static const char* OUTPUT_RAW_FILE_NAME = "hand_IterativeThresholdSelection.raw";
-
-    FILE* fileStream;
-
-    inputImage  = new byte_t[WIDTH * HEIGHT];
-    outputImage = new byte_t[WIDTH * HEIGHT];
-
-    fileStream = fopen(INPUT_RAW_FILE_NAME, "rb");
-    fread(inputImage, sizeof(byte_t), WIDTH * HEIGHT, fileStream);
-    fclose(fileStream);
-
-    printf("[Iterative Threshold] %d\n", IterativeThresholdSelection(inputImage, outputImage));
-
-    fileStream = fopen(OUTPUT_RAW_FILE_NAME, "w+b");
-    fwrite(outputImage, sizeof(byte_t), WIDTH * HEIGHT, fileStream);
-    fclose(fileStream);
+        if (CloseMappedRawFile(&outputFile) == false)
+        {
+            fprintf(stderr, "[Iterative Threshold] Can't write %s\n", outputRawFileName);
+            exitCode = 1;
+        }
+    }
 
-    delete[] inputImage;
-    delete[] outputImage;
+    CloseMappedRawFile(&inputFile);
 
-    return 0;
+    return exitCode;
 }
 
 // +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -6,97 +6,61 @@
 
 // +----------------------------------------------< INCLUDE >-----------------------------------------------+
 
-#include <cassert>
-#include <cinttypes>
-#include <cmath>
 #include <cstdio>
-#include <limits>
+#include <cstdlib>
 
-// +------------------------------------------< TYPE DEFINITION >-------------------------------------------+
+#include "Segmentation/RawFile.h"
+#include "Segmentation/ThresholdSelection.h"
 
-typedef uint8_t byte_t;
-
-// +------------------------------------------< GLOBAL VARIABLE >-------------------------------------------+
-
-static const size_t WIDTH  = 303;
-static const size_t HEIGHT = 243;
-
-byte_t* inputImage;
-byte_t* outputImage;
-
-// +-------------------------------------< KAPUR THRESHOLD SELECTION >--------------------------------------+
+// +------------------------------------------------< MAIN >------------------------------------------------+
 
-byte_t KapurThresholdSelection(byte_t* inputImage, byte_t* outputImage)
+int main(int argc, char* argv[])
 {
-    assert(inputImage  != NULL);
-    assert(outputImage != NULL);
-
-    double   histogram[256]   = { 0.0 };
-    double   entropy[256]     = { 0.0 };
-
-    uint32_t foregroundNumber = 0;
-    uint32_t backgroundNumber = WIDTH * HEIGHT;
-
-    byte_t   kapurThreshold   = 0;
-    double   maxEntropy       = DBL_MIN;
-
-    for (int iy = 0; iy < HEIGHT; ++iy)
-        for (int ix = 0; ix < WIDTH; ++ix)
-            histogram[inputImage[iy * WIDTH + ix]]++;
-
-    for (int threshold = 0; threshold < 256; ++threshold)
+    static const char*  INPUT_RAW_FILE_NAME  = "hand.raw";
+    static const char*  OUTPUT_RAW_FILE_NAME = "hand_KapurThresholdSelection.raw";
+    static const size_t WIDTH                = 303;
+    static const size_t HEIGHT               = 243;
+
+    const char* inputRawFileName  = (argc > 1) ? (argv[1]) : (INPUT_RAW_FILE_NAME);
+    const char* outputRawFileName = (argc > 2) ? (argv[2]) : (OUTPUT_RAW_FILE_NAME);
+    size_t      width             = (argc > 3) ? (strtoul(argv[3], NULL, 10)) : (WIDTH);
+    size_t      height            = (argc > 4) ? (strtoul(argv[4], NULL, 10)) : (HEIGHT);
+    size_t      sampleStride      = (argc > 5) ? (strtoul(argv[5], NULL, 10)) : (1);
+
+    MappedRawFile inputFile;
+    MappedRawFile outputFile;
+    ImageView     inputImageView;
+    ImageView     outputImageView;
+    int           exitCode = 0;
+
+    // Both frames stay in their mapped files, so nothing is copied through stdio buffers.
+    if (OpenMappedRawFile(&inputFile, inputRawFileName) == false ||
+        MapRawImageRegion(inputFile, width, 0, 0, width, height, &inputImageView) == false)
     {
-        foregroundNumber += histogram[threshold];
-        backgroundNumber -= histogram[threshold];
-
-        for (int brightness = 0; brightness <= threshold; ++brightness)
-            if (histogram[brightness] / foregroundNumber != 0)
-                entropy[threshold] -= (histogram[brightness] / foregroundNumber) * log2(histogram[brightness] / foregroundNumber);
+        fprintf(stderr, "[Kapur Threshold] Can't read %zux%zu frame from %s\n", width, height, inputRawFileName);
+        exitCode = 1;
+    }
+    else if (CreateMappedRawFile(&outputFile, outputRawFileName, width * height) == false)
+    {
+        fprintf(stderr, "[Kapur Threshold] Can't write %s\n", outputRawFileName);
+        exitCode = 1;
+    }
+    else
+    {
+        MapRawImageRegion(outputFile, width, 0, 0, width, height, &outputImageView);
 
-        for (int brightness = threshold + 1; brightness < 256; ++brightness)
-            if (histogram[brightness] / backgroundNumber != 0)
-                entropy[threshold] -= (histogram[brightness] / backgroundNumber) * log2(histogram[brightness] / backgroundNumber);
+        printf("[Kapur Threshold] %d\n", KapurThresholdSelection(inputImageView, outputImageView, THRESHOLD_SEARCH_MODE_PREFIX_SUM, (sampleStride > 0) ? (sampleStride) : (1)));
 
-        if (entropy[threshold] > maxEntropy)
+        if (CloseMappedRawFile(&outputFile) == false)
         {
-            kapurThreshold = threshold;
-            maxEntropy     = entropy[threshold];
+            fprintf(stderr, "[Kapur Threshold] Can't write %s\n", outputRawFileName);
+            exitCode = 1;
         }
     }
 
-    for (int iy = 0; iy < HEIGHT; ++iy)
-        for (int ix = 0; ix < WIDTH; ++ix)
-            outputImage[iy * WIDTH + ix] = (inputImage[iy * WIDTH + ix] < kapurThreshold) ? (0) : (255);
-
-    return kapurThreshold;
-}
-
-// +------------------------------------------------< MAIN >------------------------------------------------+
-
-int main(void)
-{
-    static const char* INPUT_RAW_FILE_NAME  = "hand.raw";
-    static const char* OUTPUT_RAW_FILE_NAME = "hand_KapurThresholdSelection.raw";
-
-    FILE* fileStream;
-
-    inputImage  = new byte_t[WIDTH * HEIGHT];
-    outputImage = new byte_t[WIDTH * HEIGHT];
-
-    fileStream = fopen(INPUT_RAW_FILE_NAME, "rb");
-    fread(inputImage, sizeof(byte_t), WIDTH * HEIGHT, fileStream);
-    fclose(fileStream);
-
-    printf("[Kapur Threshold] %d\n", KapurThresholdSelection(inputImage, outputImage));
-
-    fileStream = fopen(OUTPUT_RAW_FILE_NAME, "w+b");
-    fwrite(outputImage, sizeof(byte_t), WIDTH * HEIGHT, fileStream);
-    fclose(fileStream);
-
-    delete[] inputImage;
-    delete[] outputImage;
+    CloseMappedRawFile(&inputFile);
 
-    return 0;
+    return exitCode;
 }
 
 // +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
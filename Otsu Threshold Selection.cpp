@@ -6,103 +6,61 @@
 
 // +----------------------------------------------< INCLUDE >-----------------------------------------------+
 
-#include <cassert>
-#include <cinttypes>
 #include <cstdio>
-#include <limits>
+#include <cstdlib>
 
-// +------------------------------------------< TYPE DEFINITION >-------------------------------------------+
+#include "Segmentation/RawFile.h"
+#include "Segmentation/ThresholdSelection.h"
 
-typedef uint8_t byte_t;
-
-// +------------------------------------------< GLOBAL VARIABLE >-------------------------------------------+
-
-static const size_t WIDTH  = 303;
-static const size_t HEIGHT = 243;
-
-byte_t* inputImage;
-byte_t* outputImage;
-
-// +--------------------------------------< OTSU THRESHOLD SELECTION >--------------------------------------+
+// +------------------------------------------------< MAIN >------------------------------------------------+
 
-byte_t OtsuThresholdSelection(byte_t* inputImage, byte_t* outputImage)
+int main(int argc, char* argv[])
 {
-    assert(inputImage  != NULL);
-    assert(outputImage != NULL);
-
-    double histogram[256]   = { 0.0 };
-    double variance[256]    = { 0.0 };
-
-    double foregroundMean   = 0.0;
-    double backgroundMean   = 0.0;
-    double foregroundNumber = 0.0;
-    double backgroundNumber = WIDTH * HEIGHT;
-
-    byte_t otsuThreshold    = 0;
-    double maxVariance      = DBL_MIN;
-
-    for (int iy = 0; iy < HEIGHT; ++iy)
-        for (int ix = 0; ix < WIDTH; ++ix)
-            histogram[inputImage[iy * WIDTH + ix]]++;
-
-    for (int threshold = 0; threshold < 256; ++threshold)
+    static const char*  INPUT_RAW_FILE_NAME  = "hand.raw";
+    static const char*  OUTPUT_RAW_FILE_NAME = "hand_OtsuThresholdSelection.raw";
+    static const size_t WIDTH                = 303;
+    static const size_t HEIGHT               = 243;
+
+    const char* inputRawFileName  = (argc > 1) ? (argv[1]) : (INPUT_RAW_FILE_NAME);
+    const char* outputRawFileName = (argc > 2) ? (argv[2]) : (OUTPUT_RAW_FILE_NAME);
+    size_t      width             = (argc > 3) ? (strtoul(argv[3], NULL, 10)) : (WIDTH);
+    size_t      height            = (argc > 4) ? (strtoul(argv[4], NULL, 10)) : (HEIGHT);
+    size_t      sampleStride      = (argc > 5) ? (strtoul(argv[5], NULL, 10)) : (1);
+
+    MappedRawFile inputFile;
+    MappedRawFile outputFile;
+    ImageView     inputImageView;
+    ImageView     outputImageView;
+    int           exitCode = 0;
+
+    // Both frames stay in their mapped files, so nothing is copied through stdio buffers.
+    if (OpenMappedRawFile(&inputFile, inputRawFileName) == false ||
+        MapRawImageRegion(inputFile, width, 0, 0, width, height, &inputImageView) == false)
     {
-        foregroundMean    = 0.0;
-        backgroundMean    = 0.0;
-        foregroundNumber += histogram[threshold];
-        backgroundNumber -= histogram[threshold];
-
-        for (int brightness = 0; brightness <= threshold; ++brightness)
-            foregroundMean += histogram[brightness] * brightness;
-        foregroundMean /= foregroundNumber;
-
-        for (int brightness = threshold + 1; brightness < 256; ++brightness)
-            backgroundMean += histogram[brightness] * brightness;
-        backgroundMean /= backgroundNumber;
+        fprintf(stderr, "[Otsu Threshold] Can't read %zux%zu frame from %s\n", width, height, inputRawFileName);
+        exitCode = 1;
+    }
+    else if (CreateMappedRawFile(&outputFile, outputRawFileName, width * height) == false)
+    {
+        fprintf(stderr, "[Otsu Threshold] Can't write %s\n", outputRawFileName);
+        exitCode = 1;
+    }
+    else
+    {
+        MapRawImageRegion(outputFile, width, 0, 0, width, height, &outputImageView);
 
-        variance[threshold] = (foregroundNumber / (WIDTH * HEIGHT)) * (backgroundNumber / (WIDTH * HEIGHT)) *
-                              (foregroundMean - backgroundMean) * (foregroundMean - backgroundMean);
+        printf("[Otsu Threshold] %d\n", OtsuThresholdSelection(inputImageView, outputImageView, THRESHOLD_SEARCH_MODE_PREFIX_SUM, (sampleStride > 0) ? (sampleStride) : (1)));
 
-        if (variance[threshold] > maxVariance)
+        if (CloseMappedRawFile(&outputFile) == false)
         {
-            otsuThreshold = threshold;
-            maxVariance   = variance[threshold];
+            fprintf(stderr, "[Otsu Threshold] Can't write %s\n", outputRawFileName);
+            exitCode = 1;
         }
     }
 
-    for (int iy = 0; iy < HEIGHT; ++iy)
-        for (int ix = 0; ix < WIDTH; ++ix)
-            outputImage[iy * WIDTH + ix] = (inputImage[iy * WIDTH + ix] < otsuThreshold) ? (0) : (255);
-
-    return otsuThreshold;
-}
-
-// +------------------------------------------------< MAIN >------------------------------------------------+
-
-int main(void)
-{
-    static const char* INPUT_RAW_FILE_NAME  = "hand.raw";
-    static const char* OUTPUT_RAW_FILE_NAME = "hand_OtsuThresholdSelection.raw";
-
-    FILE* fileStream;
-
-    inputImage  = new byte_t[WIDTH * HEIGHT];
-    outputImage = new byte_t[WIDTH * HEIGHT];
-
-    fileStream = fopen(INPUT_RAW_FILE_NAME, "rb");
-    fread(inputImage, sizeof(byte_t), WIDTH * HEIGHT, fileStream);
-    fclose(fileStream);
-
-    printf("[Otsu Threshold] %d\n", OtsuThresholdSelection(inputImage, outputImage));
-
-    fileStream = fopen(OUTPUT_RAW_FILE_NAME, "w+b");
-    fwrite(outputImage, sizeof(byte_t), WIDTH * HEIGHT, fileStream);
-    fclose(fileStream);
-
-    delete[] inputImage;
-    delete[] outputImage;
+    CloseMappedRawFile(&inputFile);
 
-    return 0;
+    return exitCode;
 }
 
 // +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
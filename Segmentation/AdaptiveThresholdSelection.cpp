@@ -0,0 +1,203 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <vector>
+
+#include "Segmentation/Histogram.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +-----------------------------------------< TILE INTERPOLATION >-----------------------------------------+
+
+// Fixed-point weight of the right (or lower) tile center, in [0, 256]. Pixels outside the outermost centers get
+// weight 0 and see a single tile.
+static const uint32_t INTERPOLATION_ONE = 256;
+
+// Centers of the tiles along one axis, the last tile clipped to the frame.
+static void ComputeTileCenter(size_t imageSize, size_t tileSize, size_t tileNumber, size_t* center)
+{
+    for (size_t tileIndex = 0; tileIndex < tileNumber; ++tileIndex)
+    {
+        size_t begin = tileIndex * tileSize;
+
+        center[tileIndex] = begin + std::min(tileSize, imageSize - begin) / 2;
+    }
+}
+
+// For every coordinate along one axis, the tile whose center is at or before it and the weight of the next one.
+static void ComputeInterpolationWeight(size_t imageSize, const size_t* center, size_t tileNumber, uint32_t* lowerTile, uint32_t* weight)
+{
+    size_t tileIndex = 0;
+
+    for (size_t coordinate = 0; coordinate < imageSize; ++coordinate)
+    {
+        while (tileIndex + 1 < tileNumber && center[tileIndex + 1] <= coordinate)
+            ++tileIndex;
+
+        lowerTile[coordinate] = static_cast<uint32_t>(tileIndex);
+        weight[coordinate]    = (coordinate < center[tileIndex] || tileIndex + 1 == tileNumber) ?
+                                (0) : (static_cast<uint32_t>((coordinate - center[tileIndex]) * INTERPOLATION_ONE / (center[tileIndex + 1] - center[tileIndex])));
+    }
+}
+
+// +------------------------------------< ADAPTIVE THRESHOLD SELECTION >------------------------------------+
+
+size_t AdaptiveThresholdTileNumber(size_t imageSize, size_t tileSize)
+{
+    assert(tileSize > 0);
+
+    return std::max<size_t>(1, (imageSize + tileSize - 1) / tileSize);
+}
+
+byte_t AdaptiveThresholdSelection(ThresholdMethod method, const ImageView& inputImage, const ImageView& outputImage, size_t tileWidth, size_t tileHeight,
+                                  uint32_t minimumContrast, byte_t* tileThreshold, ThreadPool* threadPool)
+{
+    assert(inputImage.pointer  != NULL);
+    assert(outputImage.pointer != NULL);
+    assert(IsSameImageSize(inputImage, outputImage));
+    assert(tileWidth > 0 && tileHeight > 0);
+
+    const size_t width        = inputImage.width;
+    const size_t height       = inputImage.height;
+    const size_t columnNumber = AdaptiveThresholdTileNumber(width, tileWidth);
+    const size_t rowNumber    = AdaptiveThresholdTileNumber(height, tileHeight);
+    const size_t tileNumber   = columnNumber * rowNumber;
+
+    ThreadPool&           pool            = (threadPool != NULL) ? (*threadPool) : (DefaultThreadPool());
+    SimdKernel            kernel          = ResolveSimdKernel(SIMD_KERNEL_AUTO);
+    std::vector<uint32_t> tileHistogram(tileNumber * 256);
+    std::vector<byte_t>   threshold(tileNumber);
+    std::vector<byte_t>   globalTile(tileNumber);
+    std::vector<size_t>   columnCenter(columnNumber);
+    std::vector<size_t>   rowCenter(rowNumber);
+    std::vector<uint32_t> columnTile(width);
+    std::vector<uint32_t> columnWeight(width);
+    std::vector<uint32_t> rowTile(height);
+    std::vector<uint32_t> rowWeight(height);
+    uint32_t              histogram[256]  = { 0 };
+
+    if (width == 0 || height == 0)
+        return 0;
+
+    // Each band of tiles is read once, row by row, into one set of sub-histograms per tile column. Walking whole
+    // frame rows keeps the reads sequential, where tile by tile each row would only be a couple of cache lines.
+    // The frame histogram falls out as the sum of the tile histograms, so the global fallback costs no extra pass.
+    pool.ParallelFor(rowNumber, [&](size_t bandIndex)
+    {
+        const size_t top        = bandIndex * tileHeight;
+        const size_t bandHeight = std::min(tileHeight, height - top);
+
+        std::vector<uint32_t> subHistogram(columnNumber * 4 * 256, 0);
+
+        for (size_t iy = top; iy < top + bandHeight; ++iy)
+        {
+            const byte_t* row = ImageRow(inputImage, iy);
+
+            for (size_t columnIndex = 0; columnIndex < columnNumber; ++columnIndex)
+            {
+                const size_t left = columnIndex * tileWidth;
+
+                AccumulateHistogramRow(row + left, std::min(tileWidth, width - left),
+                                       reinterpret_cast<uint32_t (*)[256]>(&subHistogram[columnIndex * 4 * 256]), kernel);
+            }
+        }
+
+        for (size_t columnIndex = 0; columnIndex < columnNumber; ++columnIndex)
+        {
+            const size_t left           = columnIndex * tileWidth;
+            const size_t tileIndex      = bandIndex * columnNumber + columnIndex;
+            uint32_t*    localHistogram = &tileHistogram[tileIndex * 256];
+            ImageView    tile           = MakeImageView(ImageRow(inputImage, top) + left, std::min(tileWidth, width - left), bandHeight,
+                                                        inputImage.stride);
+
+            MergeSubHistogram(reinterpret_cast<uint32_t (*)[256]>(&subHistogram[columnIndex * 4 * 256]), localHistogram);
+
+            // The iterative seed reads the four tile corners, so clipped slivers along the frame border are left
+            // to the global threshold.
+            globalTile[tileIndex] = (tile.width <= 2 || tile.height <= 2) ? (1) : (0);
+
+            if (globalTile[tileIndex] == 0)
+                threshold[tileIndex] = SelectThreshold(method, localHistogram, tile);
+        }
+    });
+
+    for (size_t tileIndex = 0; tileIndex < tileNumber; ++tileIndex)
+    {
+        const uint32_t* localHistogram = &tileHistogram[tileIndex * 256];
+        int             minBrightness  = 0;
+        int             maxBrightness  = 255;
+
+        for (int brightness = 0; brightness < 256; ++brightness)
+            histogram[brightness] += localHistogram[brightness];
+
+        while (localHistogram[minBrightness] == 0)
+            ++minBrightness;
+        while (localHistogram[maxBrightness] == 0)
+            --maxBrightness;
+
+        if (static_cast<uint32_t>(maxBrightness - minBrightness) < minimumContrast)
+            globalTile[tileIndex] = 1;
+    }
+
+    byte_t globalThreshold = SelectThreshold(method, histogram, inputImage);
+
+    // A flat tile holds no edge, and its own threshold would split noise, so it follows the whole frame instead.
+    for (size_t tileIndex = 0; tileIndex < tileNumber; ++tileIndex)
+        if (globalTile[tileIndex] != 0)
+            threshold[tileIndex] = globalThreshold;
+
+    if (tileThreshold != NULL)
+        std::copy(threshold.begin(), threshold.end(), tileThreshold);
+
+    ComputeTileCenter(width, tileWidth, columnNumber, columnCenter.data());
+    ComputeTileCenter(height, tileHeight, rowNumber, rowCenter.data());
+    ComputeInterpolationWeight(width, columnCenter.data(), columnNumber, columnTile.data(), columnWeight.data());
+    ComputeInterpolationWeight(height, rowCenter.data(), rowNumber, rowTile.data(), rowWeight.data());
+
+    // Thresholds are interpolated in 16.16 fixed point and rounded up, so 'pixel >= threshold' matches the
+    // fractional comparison exactly and a frame of equal tile thresholds binarizes like BinarizeImage.
+    pool.ParallelFor(rowNumber, [&](size_t bandIndex)
+    {
+        std::vector<uint32_t> columnThreshold(columnNumber);
+        std::vector<byte_t>   pixelThreshold(width);
+
+        for (size_t iy = bandIndex * tileHeight; iy < std::min(height, (bandIndex + 1) * tileHeight); ++iy)
+        {
+            const byte_t*   upperThreshold = &threshold[rowTile[iy] * columnNumber];
+            const byte_t*   lowerThreshold = &threshold[std::min<size_t>(rowTile[iy] + 1, rowNumber - 1) * columnNumber];
+            const uint32_t  lowerWeight    = rowWeight[iy];
+            const byte_t*   inputRow       = ImageRow(inputImage, iy);
+            byte_t*         outputRow      = ImageRow(outputImage, iy);
+            const uint32_t* weight         = columnWeight.data();
+            const byte_t*   rowThreshold   = pixelThreshold.data();
+            const size_t    rowWidth       = width;
+
+            for (size_t columnIndex = 0; columnIndex < columnNumber; ++columnIndex)
+                columnThreshold[columnIndex] = upperThreshold[columnIndex] * (INTERPOLATION_ONE - lowerWeight) + lowerThreshold[columnIndex] * lowerWeight;
+
+            // Between two tile centers the threshold is linear in x, so each span is a plain loop over the
+            // precomputed weights that the compiler vectorizes.
+            for (size_t spanBegin = 0; spanBegin < width;)
+            {
+                const uint32_t tileIndex = columnTile[spanBegin];
+                const uint32_t left      = columnThreshold[tileIndex];
+                const uint32_t right     = columnThreshold[std::min<size_t>(tileIndex + 1, columnNumber - 1)];
+                const size_t   spanEnd   = (tileIndex + 1 < columnNumber) ? (std::max(spanBegin + 1, columnCenter[tileIndex + 1])) : (width);
+                byte_t*        spanRow   = pixelThreshold.data();
+
+                for (size_t ix = spanBegin; ix < spanEnd; ++ix)
+                    spanRow[ix] = static_cast<byte_t>((left * (INTERPOLATION_ONE - weight[ix]) + right * weight[ix] + 0xFFFF) >> 16);
+
+                spanBegin = spanEnd;
+            }
+
+            for (size_t ix = 0; ix < rowWidth; ++ix)
+                outputRow[ix] = (inputRow[ix] >= rowThreshold[ix]) ? (255) : (0);
+        }
+    });
+
+    return globalThreshold;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,274 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef _CRT_SECURE_NO_WARNINGS
+    #define _CRT_SECURE_NO_WARNINGS
+#endif
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <dirent.h>
+#endif
+
+#include "Segmentation/BatchProcessing.h"
+#include "Segmentation/RawFile.h"
+
+// +------------------------------------------< TYPE DEFINITION >-------------------------------------------+
+
+// Buffers one thread works on, handed out per frame.
+struct BatchSlot
+{
+    std::vector<byte_t> inputImage;
+    std::vector<byte_t> maskImage;
+    std::vector<byte_t> outputImage;
+    LabelingWorkspace   workspace;
+};
+
+// +------------------------------------------< BATCH PROCESSING >------------------------------------------+
+
+static double ElapsedMilliseconds(std::chrono::steady_clock::time_point& startTime)
+{
+    std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now();
+
+    double elapsed = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    startTime = endTime;
+
+    return elapsed;
+}
+
+static BatchStageLatency ComputeStageLatency(std::vector<double>& latency)
+{
+    BatchStageLatency stageLatency = { 0.0, 0.0, 0.0, 0.0 };
+
+    if (latency.empty())
+        return stageLatency;
+
+    std::sort(latency.begin(), latency.end());
+
+    auto percentile = [&latency](double rank)
+    {
+        size_t index = static_cast<size_t>(rank * latency.size() + 0.999999);
+
+        return latency[std::min(latency.size(), std::max<size_t>(index, 1)) - 1];
+    };
+
+    stageLatency.p50 = percentile(0.50);
+    stageLatency.p90 = percentile(0.90);
+    stageLatency.p99 = percentile(0.99);
+    stageLatency.max = latency.back();
+
+    return stageLatency;
+}
+
+BatchPipeline MakeBatchPipeline(size_t width, size_t height)
+{
+    BatchPipeline pipeline;
+
+    pipeline.width             = width;
+    pipeline.height            = height;
+    pipeline.thresholdMethod   = THRESHOLD_METHOD_OTSU;
+    pipeline.sampleStride      = 1;
+    pipeline.labeling          = true;
+    pipeline.labelingMode      = LABELING_MODE_UNION_FIND;
+    pipeline.areaExtractNumber = 2;
+
+    return pipeline;
+}
+
+const char* BatchStageName(BatchStage stage)
+{
+    switch (stage)
+    {
+        case BATCH_STAGE_READ:      return "read";
+        case BATCH_STAGE_THRESHOLD: return "threshold";
+        case BATCH_STAGE_LABELING:  return "labeling";
+        case BATCH_STAGE_WRITE:     return "write";
+        default:                    return "unknown";
+    }
+}
+
+bool ListRawDirectory(const char* directoryName, std::vector<std::string>& fileName)
+{
+    assert(directoryName != NULL);
+
+    std::vector<std::string> rawFileName;
+
+#if defined(_WIN32)
+    WIN32_FIND_DATAA findData;
+    HANDLE           findHandle = FindFirstFileA((std::string(directoryName) + "\\*.raw").c_str(), &findData);
+
+    if (findHandle == INVALID_HANDLE_VALUE)
+        return false;
+
+    do
+    {
+        if ((findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
+            rawFileName.push_back(std::string(directoryName) + "\\" + findData.cFileName);
+    }
+    while (FindNextFileA(findHandle, &findData) != 0);
+
+    FindClose(findHandle);
+#else
+    DIR*        directory = opendir(directoryName);
+    dirent*     entry     = NULL;
+    std::string name;
+
+    if (directory == NULL)
+        return false;
+
+    while ((entry = readdir(directory)) != NULL)
+    {
+        name = entry->d_name;
+
+        if (name.size() > 4 && name.compare(name.size() - 4, 4, ".raw") == 0)
+            rawFileName.push_back(std::string(directoryName) + "/" + name);
+    }
+
+    closedir(directory);
+#endif
+
+    std::sort(rawFileName.begin(), rawFileName.end());
+
+    fileName.insert(fileName.end(), rawFileName.begin(), rawFileName.end());
+
+    return true;
+}
+
+bool ReadRawFileList(const char* listFileName, std::vector<std::string>& fileName)
+{
+    assert(listFileName != NULL);
+
+    FILE*       fileStream = fopen(listFileName, "r");
+    char        line[4096];
+    std::string name;
+
+    if (fileStream == NULL)
+        return false;
+
+    while (fgets(line, sizeof(line), fileStream) != NULL)
+    {
+        name = line;
+
+        while (name.empty() == false && (name.back() == '\n' || name.back() == '\r' || name.back() == ' '))
+            name.pop_back();
+
+        if (name.empty() == false)
+            fileName.push_back(name);
+    }
+
+    fclose(fileStream);
+
+    return true;
+}
+
+BatchReport RunBatch(const std::vector<BatchFrame>& frame, const BatchPipeline& pipeline, ThreadPool& threadPool)
+{
+    assert(pipeline.width > 0 && pipeline.height > 0);
+
+    const size_t       frameSize    = pipeline.width * pipeline.height;
+    const size_t       frameNumber  = frame.size();
+    const LabelingMode labelingMode = (pipeline.labelingMode == LABELING_MODE_PARALLEL_UNION_FIND) ?
+                                      (LABELING_MODE_UNION_FIND) : (pipeline.labelingMode);
+
+    std::vector<BatchSlot>  slot(threadPool.ThreadNumber());
+    std::vector<BatchSlot*> freeSlot;
+    std::mutex              slotMutex;
+    std::vector<double>     latency[BATCH_STAGE_NUMBER];
+    std::vector<char>       failed(frameNumber, 0);
+    BatchReport             report;
+
+    for (size_t slotIndex = 0; slotIndex < slot.size(); ++slotIndex)
+    {
+        slot[slotIndex].inputImage.resize(frameSize);
+        slot[slotIndex].maskImage.resize(frameSize);
+        slot[slotIndex].outputImage.resize(frameSize);
+
+        freeSlot.push_back(&slot[slotIndex]);
+    }
+
+    // Stages a frame never ran, after a failed read or with labeling off, keep a negative latency and stay out of
+    // the percentiles.
+    for (int stage = 0; stage < BATCH_STAGE_NUMBER; ++stage)
+        latency[stage].assign(frameNumber, -1.0);
+
+    std::chrono::steady_clock::time_point batchStartTime = std::chrono::steady_clock::now();
+
+    threadPool.ParallelFor(frameNumber, [&](size_t frameIndex)
+    {
+        BatchSlot* frameSlot = NULL;
+
+        {
+            std::lock_guard<std::mutex> lock(slotMutex);
+
+            frameSlot = freeSlot.back();
+            freeSlot.pop_back();
+        }
+
+        ImageView inputImage  = MakeImageView(frameSlot->inputImage.data(), pipeline.width, pipeline.height);
+        ImageView maskImage   = MakeImageView(frameSlot->maskImage.data(), pipeline.width, pipeline.height);
+        ImageView outputImage = (pipeline.labeling) ? (MakeImageView(frameSlot->outputImage.data(), pipeline.width, pipeline.height)) : (maskImage);
+
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+        if (ReadRawImage(frame[frameIndex].inputFileName.c_str(), inputImage) == false)
+            failed[frameIndex] = 1;
+
+        latency[BATCH_STAGE_READ][frameIndex] = ElapsedMilliseconds(startTime);
+
+        if (failed[frameIndex] == 0)
+        {
+            if (pipeline.thresholdMethod == THRESHOLD_METHOD_KAPUR)
+                KapurThresholdSelection(inputImage, maskImage, THRESHOLD_SEARCH_MODE_PREFIX_SUM, pipeline.sampleStride);
+            else if (pipeline.thresholdMethod == THRESHOLD_METHOD_ITERATIVE)
+                IterativeThresholdSelection(inputImage, maskImage, pipeline.sampleStride);
+            else
+                OtsuThresholdSelection(inputImage, maskImage, THRESHOLD_SEARCH_MODE_PREFIX_SUM, pipeline.sampleStride);
+
+            latency[BATCH_STAGE_THRESHOLD][frameIndex] = ElapsedMilliseconds(startTime);
+
+            if (pipeline.labeling)
+            {
+                Efficient2Pass(maskImage, outputImage, pipeline.areaExtractNumber, labelingMode, NULL, NULL, &frameSlot->workspace);
+
+                latency[BATCH_STAGE_LABELING][frameIndex] = ElapsedMilliseconds(startTime);
+            }
+
+            if (WriteRawImage(frame[frameIndex].outputFileName.c_str(), outputImage) == false)
+                failed[frameIndex] = 1;
+
+            latency[BATCH_STAGE_WRITE][frameIndex] = ElapsedMilliseconds(startTime);
+        }
+
+        std::lock_guard<std::mutex> lock(slotMutex);
+
+        freeSlot.push_back(frameSlot);
+    });
+
+    report.frameNumber       = frameNumber;
+    report.failedFrameNumber = std::count(failed.begin(), failed.end(), 1);
+    report.elapsedSeconds    = std::chrono::duration<double>(std::chrono::steady_clock::now() - batchStartTime).count();
+    report.framesPerSecond   = (report.elapsedSeconds > 0.0) ? ((frameNumber - report.failedFrameNumber) / report.elapsedSeconds) : (0.0);
+
+    for (int stage = 0; stage < BATCH_STAGE_NUMBER; ++stage)
+    {
+        latency[stage].erase(std::remove_if(latency[stage].begin(), latency[stage].end(), [](double value) { return value < 0.0; }),
+                             latency[stage].end());
+
+        report.stageLatency[stage] = ComputeStageLatency(latency[stage]);
+    }
+
+    return report;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,85 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef SEGMENTATION_BATCH_PROCESSING_H
+#define SEGMENTATION_BATCH_PROCESSING_H
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cinttypes>
+#include <string>
+#include <vector>
+
+#include "Segmentation/Labeling.h"
+#include "Segmentation/ThreadPool.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +------------------------------------------< TYPE DEFINITION >-------------------------------------------+
+
+enum BatchStage
+{
+    BATCH_STAGE_READ,
+    BATCH_STAGE_THRESHOLD,
+    BATCH_STAGE_LABELING,
+    BATCH_STAGE_WRITE,
+    BATCH_STAGE_NUMBER
+};
+
+// In-memory chain run on every frame: threshold selection, then optionally labeling and top-K extraction.
+// 'sampleStride' is the histogram sampling stride of the threshold selector.
+struct BatchPipeline
+{
+    size_t          width;
+    size_t          height;
+    ThresholdMethod thresholdMethod;
+    size_t          sampleStride;
+    bool            labeling;
+    LabelingMode    labelingMode;
+    uint32_t        areaExtractNumber;
+};
+
+struct BatchFrame
+{
+    std::string inputFileName;
+    std::string outputFileName;
+};
+
+// Nearest-rank percentiles of one stage over the frames that ran it, in milliseconds. All 0 when none did.
+struct BatchStageLatency
+{
+    double p50;
+    double p90;
+    double p99;
+    double max;
+};
+
+struct BatchReport
+{
+    size_t            frameNumber;
+    size_t            failedFrameNumber;
+    double            elapsedSeconds;
+    double            framesPerSecond;
+    BatchStageLatency stageLatency[BATCH_STAGE_NUMBER];
+};
+
+// +------------------------------------------< BATCH PROCESSING >------------------------------------------+
+
+// Otsu threshold on every pixel and union-find labeling with two extracted labels, like the programs chained by
+// hand.
+BatchPipeline MakeBatchPipeline(size_t width, size_t height);
+
+const char* BatchStageName(BatchStage stage);
+
+// Appends the '.raw' files of 'directoryName' in name order, or the lines of the text file 'listFileName'.
+// Both return false when the directory or file can't be opened.
+bool ListRawDirectory(const char* directoryName, std::vector<std::string>& fileName);
+bool ReadRawFileList(const char* listFileName, std::vector<std::string>& fileName);
+
+// Runs 'pipeline' on every frame, one frame per task of 'threadPool', so the reads and writes of some frames
+// overlap the computation of others. Every thread reuses its own buffers and labeling workspace. Labeling runs
+// serially inside each frame; LABELING_MODE_PARALLEL_UNION_FIND falls back to LABELING_MODE_UNION_FIND since
+// the pool is already busy with frames. Frames that can't be read or written count as failed.
+BatchReport RunBatch(const std::vector<BatchFrame>& frame, const BatchPipeline& pipeline, ThreadPool& threadPool);
+
+#endif
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,213 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #include <immintrin.h>
+#endif
+
+#include "Segmentation/Binarization.h"
+#include "Segmentation/Histogram.h"
+#include "Segmentation/Instrumentation.h"
+
+// +--------------------------------------------< BINARIZATION >--------------------------------------------+
+
+void BinarizeRowScalar(const byte_t* inputRow, byte_t* outputRow, size_t width, byte_t threshold)
+{
+    for (size_t ix = 0; ix < width; ++ix)
+        outputRow[ix] = (inputRow[ix] < threshold) ? (0) : (255);
+}
+
+#if defined(SEGMENTATION_X86_64)
+
+// Unsigned 'pixel >= threshold' is 'max(pixel, threshold) == pixel', which yields the 0/255 bytes directly.
+void BinarizeRowSSE2(const byte_t* inputRow, byte_t* outputRow, size_t width, byte_t threshold)
+{
+    const __m128i thresholds = _mm_set1_epi8(static_cast<char>(threshold));
+
+    size_t ix = 0;
+
+    for (; ix + 16 <= width; ix += 16)
+    {
+        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inputRow + ix));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(outputRow + ix), _mm_cmpeq_epi8(_mm_max_epu8(pixels, thresholds), pixels));
+    }
+
+    BinarizeRowScalar(inputRow + ix, outputRow + ix, width - ix, threshold);
+}
+
+SEGMENTATION_TARGET_AVX2
+void BinarizeRowAVX2(const byte_t* inputRow, byte_t* outputRow, size_t width, byte_t threshold)
+{
+    const __m256i thresholds = _mm256_set1_epi8(static_cast<char>(threshold));
+
+    size_t ix = 0;
+
+    for (; ix + 32 <= width; ix += 32)
+    {
+        __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(inputRow + ix));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(outputRow + ix), _mm256_cmpeq_epi8(_mm256_max_epu8(pixels, thresholds), pixels));
+    }
+
+    BinarizeRowScalar(inputRow + ix, outputRow + ix, width - ix, threshold);
+}
+
+#else
+
+void BinarizeRowSSE2(const byte_t* inputRow, byte_t* outputRow, size_t width, byte_t threshold)
+{
+    BinarizeRowScalar(inputRow, outputRow, width, threshold);
+}
+
+void BinarizeRowAVX2(const byte_t* inputRow, byte_t* outputRow, size_t width, byte_t threshold)
+{
+    BinarizeRowScalar(inputRow, outputRow, width, threshold);
+}
+
+#endif
+
+static void BinarizeRow(const byte_t* inputRow, byte_t* outputRow, size_t width, byte_t threshold, SimdKernel kernel)
+{
+    switch (kernel)
+    {
+        case SIMD_KERNEL_AVX2: BinarizeRowAVX2(inputRow, outputRow, width, threshold);   break;
+        case SIMD_KERNEL_SSE2: BinarizeRowSSE2(inputRow, outputRow, width, threshold);   break;
+        default:               BinarizeRowScalar(inputRow, outputRow, width, threshold); break;
+    }
+}
+
+void BinarizeImage(const ImageView& inputImage, const ImageView& outputImage, byte_t threshold, SimdKernel kernel)
+{
+    assert(inputImage.pointer  != NULL);
+    assert(outputImage.pointer != NULL);
+    assert(IsSameImageSize(inputImage, outputImage));
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_BINARIZATION, inputImage.width * inputImage.height, 2 * inputImage.width * inputImage.height);
+
+    kernel = ResolveSimdKernel(kernel);
+
+    for (size_t iy = 0; iy < inputImage.height; ++iy)
+        BinarizeRow(ImageRow(inputImage, iy), ImageRow(outputImage, iy), inputImage.width, threshold, kernel);
+}
+
+uint32_t* BinarizeWithHistogram(const ImageView& inputImage, const ImageView& outputImage, byte_t threshold, uint32_t* histogram,
+                                SimdKernel kernel)
+{
+    assert(inputImage.pointer  != NULL);
+    assert(outputImage.pointer != NULL);
+    assert(IsSameImageSize(inputImage, outputImage));
+    assert(histogram != NULL);
+
+    static const size_t CHUNK_SIZE = 4096;
+
+    // The fused pass is timed as binarization, its histogram costs no extra read.
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_BINARIZATION, inputImage.width * inputImage.height, 2 * inputImage.width * inputImage.height);
+
+    uint32_t subHistogram[4][256];
+    size_t   chunkWidth = 0;
+
+    memset(subHistogram, 0, sizeof(subHistogram));
+    memset(histogram, 0, sizeof(uint32_t) * 256);
+
+    kernel = ResolveSimdKernel(kernel);
+
+    // The histogram reads each chunk before it is binarized, so the pass also works in place.
+    for (size_t iy = 0; iy < inputImage.height; ++iy)
+    {
+        const byte_t* inputRow  = ImageRow(inputImage, iy);
+        byte_t*       outputRow = ImageRow(outputImage, iy);
+
+        for (size_t ix = 0; ix < inputImage.width; ix += chunkWidth)
+        {
+            chunkWidth = std::min(CHUNK_SIZE, inputImage.width - ix);
+
+            AccumulateHistogramRow(inputRow + ix, chunkWidth, subHistogram, kernel);
+            BinarizeRow(inputRow + ix, outputRow + ix, chunkWidth, threshold, kernel);
+        }
+    }
+
+    MergeSubHistogram(subHistogram, histogram);
+
+    return histogram;
+}
+
+void QuantizeImage(const ImageView& inputImage, const ImageView& outputImage, const byte_t* threshold, uint32_t thresholdNumber)
+{
+    assert(inputImage.pointer  != NULL);
+    assert(outputImage.pointer != NULL);
+    assert(IsSameImageSize(inputImage, outputImage));
+    assert(threshold != NULL);
+    assert(thresholdNumber > 0);
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_BINARIZATION, inputImage.width * inputImage.height, 2 * inputImage.width * inputImage.height);
+
+    byte_t   levelTable[256];
+    uint32_t level = 0;
+
+    for (int brightness = 0; brightness < 256; ++brightness)
+    {
+        while (level < thresholdNumber && threshold[level] <= brightness)
+            ++level;
+
+        levelTable[brightness] = static_cast<byte_t>(level * 255 / thresholdNumber);
+    }
+
+    for (size_t iy = 0; iy < inputImage.height; ++iy)
+    {
+        const byte_t* inputRow  = ImageRow(inputImage, iy);
+        byte_t*       outputRow = ImageRow(outputImage, iy);
+
+        for (size_t ix = 0; ix < inputImage.width; ++ix)
+            outputRow[ix] = levelTable[inputRow[ix]];
+    }
+}
+
+// +----------------------------------------< BINARIZATION STREAM >-----------------------------------------+
+
+void InitBinarizationStream(BinarizationStream* stream, ThresholdMethod method, SimdKernel kernel)
+{
+    assert(stream != NULL);
+
+    stream->method    = method;
+    stream->kernel    = ResolveSimdKernel(kernel);
+    stream->threshold = 0;
+    stream->primed    = false;
+}
+
+byte_t ProcessBinarizationStream(BinarizationStream* stream, const ImageView& inputImage, const ImageView& outputImage)
+{
+    assert(stream != NULL);
+
+    uint32_t histogram[256];
+    uint32_t cornerSum        = SumImageCorner(inputImage);
+    byte_t   appliedThreshold = 0;
+
+    if (stream->primed == false)
+    {
+        ComputeHistogram(inputImage, histogram, stream->kernel);
+
+        appliedThreshold = SelectThreshold(stream->method, histogram, inputImage.width, inputImage.height, cornerSum);
+        BinarizeImage(inputImage, outputImage, appliedThreshold, stream->kernel);
+
+        stream->threshold = appliedThreshold;
+        stream->primed    = true;
+
+        return appliedThreshold;
+    }
+
+    appliedThreshold = stream->threshold;
+
+    BinarizeWithHistogram(inputImage, outputImage, appliedThreshold, histogram, stream->kernel);
+
+    // The corners were summed before the pass, so the next threshold stays correct when binarizing in place.
+    stream->threshold = SelectThreshold(stream->method, histogram, inputImage.width, inputImage.height, cornerSum);
+
+    return appliedThreshold;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,54 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef SEGMENTATION_BINARIZATION_H
+#define SEGMENTATION_BINARIZATION_H
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cinttypes>
+
+#include "Segmentation/CpuFeature.h"
+#include "Segmentation/Image.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +------------------------------------------< TYPE DEFINITION >-------------------------------------------+
+
+// State of a video stream binarized with the previous frame's threshold. Prime it with InitBinarizationStream.
+struct BinarizationStream
+{
+    ThresholdMethod method;
+    SimdKernel      kernel;
+    byte_t          threshold;
+    bool            primed;
+};
+
+// +--------------------------------------------< BINARIZATION >--------------------------------------------+
+
+// Writes 0 where 'inputImage' is below 'threshold' and 255 elsewhere. 'outputImage' may alias 'inputImage'.
+void BinarizeImage(const ImageView& inputImage, const ImageView& outputImage, byte_t threshold, SimdKernel kernel = SIMD_KERNEL_AUTO);
+
+void BinarizeRowScalar(const byte_t* inputRow, byte_t* outputRow, size_t width, byte_t threshold);
+void BinarizeRowSSE2(const byte_t* inputRow, byte_t* outputRow, size_t width, byte_t threshold);
+void BinarizeRowAVX2(const byte_t* inputRow, byte_t* outputRow, size_t width, byte_t threshold);
+
+// Binarizes with 'threshold' and fills 'histogram[256]' from the same read of 'inputImage'. Rows are handled in
+// cache-sized chunks, so every pixel is loaded from memory once.
+uint32_t* BinarizeWithHistogram(const ImageView& inputImage, const ImageView& outputImage, byte_t threshold, uint32_t* histogram,
+                                SimdKernel kernel = SIMD_KERNEL_AUTO);
+
+// Multi-level analogue of BinarizeImage for 'thresholdNumber' increasing thresholds: a pixel with 'level'
+// thresholds at or below it becomes 'level * 255 / thresholdNumber'. 'outputImage' may alias 'inputImage'.
+void QuantizeImage(const ImageView& inputImage, const ImageView& outputImage, const byte_t* threshold, uint32_t thresholdNumber);
+
+// +----------------------------------------< BINARIZATION STREAM >-----------------------------------------+
+
+void InitBinarizationStream(BinarizationStream* stream, ThresholdMethod method, SimdKernel kernel = SIMD_KERNEL_AUTO);
+
+// Binarizes frame N with the threshold selected on frame N - 1 while building frame N's histogram in the same
+// pass, then selects the threshold for frame N + 1. The first frame is handled in two passes like the selectors.
+// Returns the threshold applied to this frame.
+byte_t ProcessBinarizationStream(BinarizationStream* stream, const ImageView& inputImage, const ImageView& outputImage);
+
+#endif
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,509 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef _CRT_SECURE_NO_WARNINGS
+    #define _CRT_SECURE_NO_WARNINGS
+#endif
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #include <immintrin.h>
+#endif
+
+#include "Segmentation/BitMask.h"
+#include "Segmentation/CpuFeature.h"
+#include "Segmentation/Instrumentation.h"
+
+// +----------------------------------------------< BIT MASK >----------------------------------------------+
+
+// Set bits of the last word of a 'width' pixel row.
+static inline uint64_t TailMask(size_t width)
+{
+    return (width % 64 == 0) ? (~static_cast<uint64_t>(0)) : ((static_cast<uint64_t>(1) << (width % 64)) - 1);
+}
+
+// Index of the lowest set bit of a nonzero word: the isolated bit times a De Bruijn sequence leaves a distinct
+// pattern in the top 6 bits.
+static inline size_t LowestBitIndex(uint64_t word)
+{
+    static const uint8_t DE_BRUIJN_INDEX[64] =
+    {
+         0,  1, 48,  2, 57, 49, 28,  3, 61, 58, 50, 42, 38, 29, 17,  4, 62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12,  5,
+        63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11, 46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19,  9, 13,  8,  7,  6
+    };
+
+    assert(word != 0);
+
+    return DE_BRUIJN_INDEX[((word & (0 - word)) * 0x03F79D71B4CB0A89ull) >> 58];
+}
+
+// Sets or clears pixels [beginColumn, endColumn) of a row.
+static void FillBitRange(uint64_t* row, size_t beginColumn, size_t endColumn, bool set)
+{
+    size_t beginWord = beginColumn / 64;
+    size_t endWord   = (endColumn - 1) / 64;
+
+    uint64_t beginMask = ~static_cast<uint64_t>(0) << (beginColumn % 64);
+    uint64_t endMask   = TailMask(endColumn);
+
+    if (beginWord == endWord)
+        beginMask &= endMask;
+
+    row[beginWord] = (set) ? (row[beginWord] | beginMask) : (row[beginWord] & ~beginMask);
+
+    if (beginWord == endWord)
+        return;
+
+    for (size_t wordIndex = beginWord + 1; wordIndex < endWord; ++wordIndex)
+        row[wordIndex] = (set) ? (~static_cast<uint64_t>(0)) : (0);
+
+    row[endWord] = (set) ? (row[endWord] | endMask) : (row[endWord] & ~endMask);
+}
+
+// Packs the pixels of a row at or above 'threshold'.
+static void ThresholdBitMaskRow(const byte_t* inputRow, size_t width, byte_t threshold, uint64_t* row)
+{
+    size_t ix = 0;
+
+#if defined(SEGMENTATION_X86_64)
+    const __m128i thresholdVector = _mm_set1_epi8(static_cast<char>(threshold));
+
+    // max(x, t) == x exactly where x >= t, and the byte sign masks of four blocks make one word.
+    for (; ix + 64 <= width; ix += 64)
+    {
+        uint64_t word = 0;
+
+        for (size_t blockIndex = 0; blockIndex < 4; ++blockIndex)
+        {
+            __m128i pixel = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inputRow + ix + 16 * blockIndex));
+
+            word |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(pixel, thresholdVector), pixel))))
+                    << (16 * blockIndex);
+        }
+
+        row[ix / 64] = word;
+    }
+#endif
+
+    for (; ix < width; ix += 64)
+    {
+        const size_t count = std::min<size_t>(64, width - ix);
+        uint64_t     word  = 0;
+
+        for (size_t bitIndex = 0; bitIndex < count; ++bitIndex)
+            word |= static_cast<uint64_t>(inputRow[ix + bitIndex] >= threshold) << bitIndex;
+
+        row[ix / 64] = word;
+    }
+}
+
+void InitBitMask(BitMask* mask, size_t width, size_t height)
+{
+    assert(mask != NULL);
+
+    mask->width      = width;
+    mask->height     = height;
+    mask->wordStride = (width + 63) / 64;
+
+    mask->word.assign(mask->wordStride * height, 0);
+}
+
+void PackBitMask(const ImageView& maskImage, BitMask* mask)
+{
+    ThresholdBitMask(maskImage, 1, mask);
+}
+
+void UnpackBitMask(const BitMask& mask, const ImageView& outputImage)
+{
+    assert(outputImage.pointer != NULL);
+    assert(outputImage.width == mask.width && outputImage.height == mask.height);
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_MASK_OUTPUT, mask.width * mask.height, mask.width * mask.height + mask.word.size() * sizeof(uint64_t));
+
+    // The eight pixels of every value of a mask byte, in memory order.
+    static const std::vector<std::array<byte_t, 8>> BYTE_PIXEL = []()
+    {
+        std::vector<std::array<byte_t, 8>> bytePixel(256);
+
+        for (int value = 0; value < 256; ++value)
+            for (int bitIndex = 0; bitIndex < 8; ++bitIndex)
+                bytePixel[value][bitIndex] = (((value >> bitIndex) & 1) != 0) ? (255) : (0);
+
+        return bytePixel;
+    }();
+
+    for (size_t iy = 0; iy < mask.height; ++iy)
+    {
+        const uint64_t* row       = BitMaskRow(mask, iy);
+        byte_t*         outputRow = ImageRow(outputImage, iy);
+        size_t          ix        = 0;
+
+        for (; ix + 8 <= mask.width; ix += 8)
+            memcpy(outputRow + ix, BYTE_PIXEL[static_cast<byte_t>(row[ix / 64] >> (ix % 64))].data(), 8);
+
+        for (; ix < mask.width; ++ix)
+            outputRow[ix] = (((row[ix / 64] >> (ix % 64)) & 1) != 0) ? (255) : (0);
+    }
+}
+
+void ThresholdBitMask(const ImageView& inputImage, byte_t threshold, BitMask* mask)
+{
+    assert(inputImage.pointer != NULL);
+    assert(mask != NULL);
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_BINARIZATION, inputImage.width * inputImage.height,
+                       inputImage.width * inputImage.height + (inputImage.width + 7) / 8 * inputImage.height);
+
+    mask->width      = inputImage.width;
+    mask->height     = inputImage.height;
+    mask->wordStride = (inputImage.width + 63) / 64;
+
+    mask->word.resize(mask->wordStride * mask->height);
+
+    for (size_t iy = 0; iy < mask->height; ++iy)
+        ThresholdBitMaskRow(ImageRow(inputImage, iy), inputImage.width, threshold, BitMaskRow(*mask, iy));
+}
+
+// +----------------------------------------< BIT MASK MORPHOLOGY >-----------------------------------------+
+
+// 1x3 minimum (erosion) or maximum (dilation) of every row. A word sees its left neighbours shifted up by one bit
+// with the top bit of the word before carried in, and its right neighbours shifted down the same way.
+static void HorizontalBitMaskPass(const BitMask& input, BitMask* output, bool erode)
+{
+    const size_t   wordNumber = input.wordStride;
+    const uint64_t tailMask   = TailMask(input.width);
+    const uint64_t outside    = (erode) ? (~static_cast<uint64_t>(0)) : (0);
+    const uint64_t tailFill   = (erode) ? (~tailMask) : (0);
+
+    for (size_t iy = 0; iy < input.height; ++iy)
+    {
+        const uint64_t* row       = BitMaskRow(input, iy);
+        uint64_t*       outputRow = BitMaskRow(*output, iy);
+        uint64_t        prevWord  = outside;
+        uint64_t        word      = row[0] | ((wordNumber == 1) ? (tailFill) : (0));
+        uint64_t        nextWord  = 0;
+        uint64_t        leftWord  = 0;
+        uint64_t        rightWord = 0;
+
+        for (size_t wordIndex = 0; wordIndex < wordNumber; ++wordIndex)
+        {
+            nextWord  = (wordIndex + 1 < wordNumber) ? (row[wordIndex + 1] | ((wordIndex + 2 == wordNumber) ? (tailFill) : (0))) : (outside);
+            leftWord  = (word << 1) | (prevWord >> 63);
+            rightWord = (word >> 1) | (nextWord << 63);
+
+            outputRow[wordIndex] = (erode) ? (word & leftWord & rightWord) : (word | leftWord | rightWord);
+
+            prevWord = word;
+            word     = nextWord;
+        }
+
+        outputRow[wordNumber - 1] &= tailMask;
+    }
+}
+
+// 3x1 minimum or maximum of every column. Rows outside the frame are left out, which is taking them as
+// foreground for the minimum and background for the maximum.
+static void VerticalBitMaskPass(const BitMask& input, BitMask* output, bool erode)
+{
+    const size_t wordNumber = input.wordStride;
+
+    for (size_t iy = 0; iy < input.height; ++iy)
+    {
+        const uint64_t* row       = BitMaskRow(input, iy);
+        const uint64_t* upRow     = (iy > 0) ? (BitMaskRow(input, iy - 1)) : (NULL);
+        const uint64_t* downRow   = (iy + 1 < input.height) ? (BitMaskRow(input, iy + 1)) : (NULL);
+        uint64_t*       outputRow = BitMaskRow(*output, iy);
+
+        for (size_t wordIndex = 0; wordIndex < wordNumber; ++wordIndex)
+        {
+            uint64_t word = row[wordIndex];
+
+            if (upRow != NULL)
+                word = (erode) ? (word & upRow[wordIndex]) : (word | upRow[wordIndex]);
+
+            if (downRow != NULL)
+                word = (erode) ? (word & downRow[wordIndex]) : (word | downRow[wordIndex]);
+
+            outputRow[wordIndex] = word;
+        }
+    }
+}
+
+// The 3x3 square splits into a row pass and a column pass. The row pass reads 'input' and the column pass
+// writes 'output', so the two may be the same mask.
+static void MorphologyBitMask(const BitMask& input, BitMask* output, BitMask* temporary, bool erode)
+{
+    assert(output != NULL && temporary != NULL);
+    assert(temporary != &input && temporary != output);
+    assert(input.width > 0 && input.height > 0);
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_MORPHOLOGY, input.width * input.height, 4 * input.word.size() * sizeof(uint64_t));
+
+    temporary->width      = input.width;
+    temporary->height     = input.height;
+    temporary->wordStride = input.wordStride;
+
+    temporary->word.resize(input.word.size());
+
+    HorizontalBitMaskPass(input, temporary, erode);
+
+    if (output != &input)
+    {
+        output->width      = input.width;
+        output->height     = input.height;
+        output->wordStride = input.wordStride;
+
+        output->word.resize(input.word.size());
+    }
+
+    VerticalBitMaskPass(*temporary, output, erode);
+}
+
+void ErodeBitMask(const BitMask& input, BitMask* output, BitMask* temporary)
+{
+    BitMask localTemporary;
+
+    MorphologyBitMask(input, output, (temporary != NULL) ? (temporary) : (&localTemporary), true);
+}
+
+void DilateBitMask(const BitMask& input, BitMask* output, BitMask* temporary)
+{
+    BitMask localTemporary;
+
+    MorphologyBitMask(input, output, (temporary != NULL) ? (temporary) : (&localTemporary), false);
+}
+
+void OpenBitMask(const BitMask& input, BitMask* output, BitMask* temporary)
+{
+    BitMask localTemporary;
+
+    if (temporary == NULL)
+        temporary = &localTemporary;
+
+    MorphologyBitMask(input, output, temporary, true);
+    MorphologyBitMask(*output, output, temporary, false);
+}
+
+void CloseBitMask(const BitMask& input, BitMask* output, BitMask* temporary)
+{
+    BitMask localTemporary;
+
+    if (temporary == NULL)
+        temporary = &localTemporary;
+
+    MorphologyBitMask(input, output, temporary, false);
+    MorphologyBitMask(*output, output, temporary, true);
+}
+
+// +-----------------------------------------< BIT MASK LABELING >------------------------------------------+
+
+// First column from 'ix' on whose bit is 'set', 'width' when there is none. Cleared words are skipped whole.
+static inline size_t FindBitEdge(const uint64_t* row, size_t wordNumber, size_t width, size_t ix, bool set)
+{
+    if (ix >= width)
+        return width;
+
+    size_t   wordIndex = ix / 64;
+    uint64_t word      = ((set) ? (row[wordIndex]) : (~row[wordIndex])) & (~static_cast<uint64_t>(0) << (ix % 64));
+
+    while (word == 0)
+    {
+        if (++wordIndex == wordNumber)
+            return width;
+
+        word = (set) ? (row[wordIndex]) : (~row[wordIndex]);
+    }
+
+    // The clear bits past 'width' end the last run of a row at 'width' at the latest.
+    return std::min(wordIndex * 64 + LowestBitIndex(word), width);
+}
+
+void EncodeBitMaskRun(const BitMask& mask, std::vector<LabelRun>& run, std::vector<size_t>& rowRunIndex)
+{
+    assert(IsLabelRunFrame(mask.width, mask.height));
+
+    const size_t width  = mask.width;
+    const size_t height = mask.height;
+
+    LabelRun labelRun;
+    size_t   ix = 0;
+
+    rowRunIndex.resize(height + 1);
+
+    labelRun.label = 0;
+    labelRun.value = 255;
+
+    for (size_t iy = 0; iy < height; ++iy)
+    {
+        const uint64_t* row = BitMaskRow(mask, iy);
+
+        rowRunIndex[iy] = run.size();
+        labelRun.row    = static_cast<uint32_t>(iy);
+        ix              = FindBitEdge(row, mask.wordStride, width, 0, true);
+
+        while (ix < width)
+        {
+            labelRun.beginColumn = static_cast<uint32_t>(ix);
+
+            ix = CutLabelRunEnd(labelRun.beginColumn, FindBitEdge(row, mask.wordStride, width, ix + 1, false), iy, width, height);
+
+            labelRun.endColumn = static_cast<uint32_t>(ix);
+
+            run.push_back(labelRun);
+
+            if (ix < width && ((row[ix / 64] >> (ix % 64)) & 1) == 0)
+                ix = FindBitEdge(row, mask.wordStride, width, ix + 1, true);
+        }
+    }
+
+    rowRunIndex[height] = run.size();
+}
+
+BitMask* BitMaskEfficient2Pass(const BitMask& input, BitMask* output, uint32_t areaExtractNumber, uint32_t* extractedComponent,
+                               LabelingWorkspace* workspace)
+{
+    assert(output != NULL);
+    assert(input.width > 0 && input.height > 0);
+    assert(areaExtractNumber > 0);
+
+    LabelingWorkspace localWorkspace;
+
+    if (workspace == NULL)
+        workspace = &localWorkspace;
+
+    const size_t width  = input.width;
+    const size_t height = input.height;
+
+    if (IsLabelRunFrame(width, height) == false)
+    {
+        std::vector<byte_t> maskImage(width * height);
+        ImageView           maskView = MakeImageView(maskImage.data(), width, height);
+
+        UnpackBitMask(input, maskView);
+        Efficient2Pass(maskView, maskView, areaExtractNumber, LABELING_MODE_UNION_FIND, NULL, NULL, workspace);
+        PackBitMask(maskView, output);
+    }
+    else
+    {
+        SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_LABELING, width * height, 2 * input.word.size() * sizeof(uint64_t));
+
+        const std::vector<LabelRun>& run             = workspace->run;
+        uint32_t                     componentNumber = 0;
+        const byte_t*                keepTable       = NULL;
+        bool                         background      = false;
+
+        auto encode = [&](std::vector<LabelRun>& encodedRun, std::vector<size_t>& rowRunIndex)
+        {
+            EncodeBitMaskRun(input, encodedRun, rowRunIndex);
+        };
+
+        componentNumber = LabelRunPipeline(workspace, width, height, width * height, input.word.size() * sizeof(uint64_t), NULL, NULL, encode);
+
+        keepTable  = SelectLargeAreaRun(componentNumber, areaExtractNumber, workspace);
+        background = (keepTable[0] != 0);
+
+        // The runs hold everything the output needs, so it may overwrite the input from here on.
+        if (output != &input)
+        {
+            output->width      = width;
+            output->height     = height;
+            output->wordStride = input.wordStride;
+
+            output->word.resize(input.word.size());
+        }
+
+        {
+            SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_MASK_OUTPUT, width * height, output->word.size() * sizeof(uint64_t));
+
+            for (size_t iy = 0; iy < height; ++iy)
+            {
+                uint64_t* row = BitMaskRow(*output, iy);
+
+                std::fill(row, row + output->wordStride, (background) ? (~static_cast<uint64_t>(0)) : (0));
+
+                row[output->wordStride - 1] &= TailMask(width);
+            }
+
+            for (size_t runIndex = 0; runIndex < run.size(); ++runIndex)
+                if ((keepTable[run[runIndex].label] != 0) != background)
+                    FillBitRange(BitMaskRow(*output, run[runIndex].row), run[runIndex].beginColumn, run[runIndex].endColumn, background == false);
+        }
+
+        SEGMENTATION_COUNT(INSTRUMENTATION_COUNTER_PASS, 1);
+    }
+
+    CopyExtractedComponent(*workspace, areaExtractNumber, extractedComponent);
+
+    return output;
+}
+
+// +-------------------------------------------< BIT MASK FILE >--------------------------------------------+
+
+bool ReadBitMask(const char* fileName, size_t width, size_t height, BitMask* mask)
+{
+    assert(fileName != NULL);
+    assert(mask     != NULL);
+
+    const size_t rowByteNumber = (width + 7) / 8;
+
+    std::vector<byte_t> rowByte(rowByteNumber);
+    FILE*               fileStream = fopen(fileName, "rb");
+    bool                success    = (fileStream != NULL);
+
+    InitBitMask(mask, width, height);
+
+    for (size_t iy = 0; success && iy < height; ++iy)
+    {
+        uint64_t* row = BitMaskRow(*mask, iy);
+
+        success = (fread(rowByte.data(), sizeof(byte_t), rowByteNumber, fileStream) == rowByteNumber);
+
+        for (size_t byteIndex = 0; success && byteIndex < rowByteNumber; ++byteIndex)
+            row[byteIndex / 8] |= static_cast<uint64_t>(rowByte[byteIndex]) << (8 * (byteIndex % 8));
+
+        // Padding bits of the last byte are not part of the frame.
+        if (success && width > 0)
+            row[mask->wordStride - 1] &= TailMask(width);
+    }
+
+    if (fileStream != NULL)
+        fclose(fileStream);
+
+    return success;
+}
+
+bool WriteBitMask(const char* fileName, const BitMask& mask)
+{
+    assert(fileName != NULL);
+
+    const size_t rowByteNumber = (mask.width + 7) / 8;
+
+    std::vector<byte_t> rowByte(rowByteNumber);
+    FILE*               fileStream = fopen(fileName, "w+b");
+    bool                success    = (fileStream != NULL);
+
+    for (size_t iy = 0; success && iy < mask.height; ++iy)
+    {
+        const uint64_t* row = BitMaskRow(mask, iy);
+
+        for (size_t byteIndex = 0; byteIndex < rowByteNumber; ++byteIndex)
+            rowByte[byteIndex] = static_cast<byte_t>(row[byteIndex / 8] >> (8 * (byteIndex % 8)));
+
+        success = (fwrite(rowByte.data(), sizeof(byte_t), rowByteNumber, fileStream) == rowByteNumber);
+    }
+
+    if (fileStream != NULL)
+        success = (fclose(fileStream) == 0) && success;
+
+    return success;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,97 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef SEGMENTATION_BIT_MASK_H
+#define SEGMENTATION_BIT_MASK_H
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cinttypes>
+#include <vector>
+
+#include "Segmentation/Image.h"
+#include "Segmentation/Labeling.h"
+
+// +------------------------------------------< TYPE DEFINITION >-------------------------------------------+
+
+// Binary mask at one bit per pixel, 8 times smaller than a 0/255 frame. Pixel 'ix' of a row is bit 'ix % 64' of
+// word 'ix / 64', set for the foreground. Rows are 'wordStride' words apart and the bits past 'width' stay 0.
+struct BitMask
+{
+    size_t                width;
+    size_t                height;
+    size_t                wordStride;
+    std::vector<uint64_t> word;
+
+    BitMask(void) : width(0), height(0), wordStride(0) {}
+};
+
+// +----------------------------------------------< BIT MASK >----------------------------------------------+
+
+// Sizes 'mask' for a 'width * height' frame and clears it, reusing its storage.
+void InitBitMask(BitMask* mask, size_t width, size_t height);
+
+inline uint64_t* BitMaskRow(BitMask& mask, size_t iy)
+{
+    assert(iy < mask.height);
+
+    return mask.word.data() + iy * mask.wordStride;
+}
+
+inline const uint64_t* BitMaskRow(const BitMask& mask, size_t iy)
+{
+    assert(iy < mask.height);
+
+    return mask.word.data() + iy * mask.wordStride;
+}
+
+inline bool BitMaskPixel(const BitMask& mask, size_t ix, size_t iy)
+{
+    assert(ix < mask.width);
+
+    return ((BitMaskRow(mask, iy)[ix / 64] >> (ix % 64)) & 1) != 0;
+}
+
+// Packs a 0/255 mask, any nonzero pixel counting as foreground, and unpacks it back to 0/255.
+void PackBitMask(const ImageView& maskImage, BitMask* mask);
+void UnpackBitMask(const BitMask& mask, const ImageView& outputImage);
+
+// The bit mask of BinarizeImage at 'threshold', read off the grayscale frame: pixels at or above 'threshold'
+// are set. No 0/255 frame is written.
+void ThresholdBitMask(const ImageView& inputImage, byte_t threshold, BitMask* mask);
+
+// +----------------------------------------< BIT MASK MORPHOLOGY >-----------------------------------------+
+
+// Erosion and dilation with the 3x3 square, a row of 64 pixels per word operation. Pixels outside the frame
+// never change the result: erosion takes them as foreground and dilation as background, so objects touching the
+// border don't shrink from it. Opening (erosion, then dilation) removes specks and one pixel bridges, closing
+// (dilation, then erosion) fills pinholes and one pixel gaps. 'output' may be 'input'. 'temporary' holds the
+// intermediate rows and must be neither; when NULL a local one is allocated.
+void ErodeBitMask(const BitMask& input, BitMask* output, BitMask* temporary = NULL);
+void DilateBitMask(const BitMask& input, BitMask* output, BitMask* temporary = NULL);
+void OpenBitMask(const BitMask& input, BitMask* output, BitMask* temporary = NULL);
+void CloseBitMask(const BitMask& input, BitMask* output, BitMask* temporary = NULL);
+
+// +-----------------------------------------< BIT MASK LABELING >------------------------------------------+
+
+// EncodeLabelRun of the unpacked mask, run edges found a word at a time: runs of set bits with value 255,
+// split where the pixel engines have no horizontal link. Needs 'width >= 3' and 'height >= 2'.
+void     EncodeBitMaskRun(const BitMask& mask, std::vector<LabelRun>& run, std::vector<size_t>& rowRunIndex);
+
+// Efficient2Pass on a bit mask: writes the 'areaExtractNumber' largest components to 'output' as set bits, the
+// bit mask of what Efficient2Pass writes for the unpacked mask. 'output' may be 'input'. 'extractedComponent',
+// when given, needs 'areaExtractNumber' entries and receives the extracted component numbers like in
+// FusedSegmentation. Frames narrower than 3 or shorter than 2 go through a 0/255 copy.
+BitMask* BitMaskEfficient2Pass(const BitMask& input, BitMask* output, uint32_t areaExtractNumber = 1, uint32_t* extractedComponent = NULL,
+                               LabelingWorkspace* workspace = NULL);
+
+// +-------------------------------------------< BIT MASK FILE >--------------------------------------------+
+
+// Headerless packed masks, 8 times smaller than the RAW files of 'Resource/': rows of '(width + 7) / 8' bytes,
+// pixel 'ix' in bit 'ix % 8' of byte 'ix / 8', the same layout on every host. ReadBitMask sizes 'mask' for the
+// 'width * height' frame first. Both return false when the file can't be opened or holds too few bytes.
+bool ReadBitMask(const char* fileName, size_t width, size_t height, BitMask* mask);
+bool WriteBitMask(const char* fileName, const BitMask& mask);
+
+#endif
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,331 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "Segmentation/ComponentStatistics.h"
+
+// +----------------------------------------< COMPONENT STATISTICS >----------------------------------------+
+
+static void AppendComponent(ComponentStatistics* statistics)
+{
+    statistics->componentNumber++;
+
+    statistics->area.push_back(0);
+    statistics->left.push_back(UINT32_MAX);
+    statistics->top.push_back(UINT32_MAX);
+    statistics->right.push_back(0);
+    statistics->bottom.push_back(0);
+    statistics->sumX.push_back(0);
+    statistics->sumY.push_back(0);
+    statistics->sumXX.push_back(0);
+    statistics->sumXY.push_back(0);
+    statistics->sumYY.push_back(0);
+    statistics->sumIntensity.push_back(0);
+    statistics->adjacency.push_back(0);
+}
+
+// Sum of x * x over [0, end).
+static uint64_t SumSquare(uint64_t end)
+{
+    return (end == 0) ? (0) : ((end - 1) * end * (2 * end - 1) / 6);
+}
+
+void ResetComponentStatistics(ComponentStatistics* statistics, uint32_t componentNumber)
+{
+    assert(statistics != NULL);
+
+    statistics->componentNumber = 0;
+
+    statistics->area.clear();
+    statistics->left.clear();
+    statistics->top.clear();
+    statistics->right.clear();
+    statistics->bottom.clear();
+    statistics->sumX.clear();
+    statistics->sumY.clear();
+    statistics->sumXX.clear();
+    statistics->sumXY.clear();
+    statistics->sumYY.clear();
+    statistics->sumIntensity.clear();
+    statistics->adjacency.clear();
+
+    for (uint32_t component = 0; component < componentNumber; ++component)
+        AppendComponent(statistics);
+}
+
+void FinishComponentStatistics(ComponentStatistics* statistics)
+{
+    assert(statistics != NULL);
+
+    const uint32_t componentNumber = statistics->componentNumber;
+
+    double area = 0.0;
+
+    statistics->perimeter.resize(componentNumber);
+    statistics->centroidX.resize(componentNumber);
+    statistics->centroidY.resize(componentNumber);
+    statistics->momentXX.resize(componentNumber);
+    statistics->momentXY.resize(componentNumber);
+    statistics->momentYY.resize(componentNumber);
+    statistics->meanIntensity.resize(componentNumber);
+
+    for (uint32_t component = 0; component < componentNumber; ++component)
+    {
+        area = statistics->area[component];
+
+        // Each pixel brings four edges and every 4-adjacent pair inside the component hides two of them.
+        statistics->perimeter[component]     = 4 * statistics->area[component] - 2 * statistics->adjacency[component];
+        statistics->centroidX[component]     = statistics->sumX[component] / area;
+        statistics->centroidY[component]     = statistics->sumY[component] / area;
+        statistics->momentXX[component]      = statistics->sumXX[component] / area - statistics->centroidX[component] * statistics->centroidX[component];
+        statistics->momentXY[component]      = statistics->sumXY[component] / area - statistics->centroidX[component] * statistics->centroidY[component];
+        statistics->momentYY[component]      = statistics->sumYY[component] / area - statistics->centroidY[component] * statistics->centroidY[component];
+        statistics->meanIntensity[component] = statistics->sumIntensity[component] / area;
+    }
+}
+
+double ComponentOrientation(const ComponentStatistics& statistics, uint32_t component)
+{
+    assert(component < statistics.componentNumber);
+    assert(statistics.momentXX.size() == statistics.componentNumber);
+
+    return 0.5 * atan2(2.0 * statistics.momentXY[component], statistics.momentXX[component] - statistics.momentYY[component]);
+}
+
+uint32_t MeasureLabelPlane(const uint32_t* label, size_t width, size_t height, uint32_t labelNumber, const ImageView* intensityImage,
+                           ComponentStatistics* statistics, uint32_t* componentLabel)
+{
+    assert(label          != NULL);
+    assert(statistics     != NULL);
+    assert(componentLabel != NULL);
+    assert(intensityImage == NULL || (intensityImage->width == width && intensityImage->height == height));
+
+    uint32_t component = 0;
+    uint32_t value     = 0;
+
+    ResetComponentStatistics(statistics, 0);
+
+    memset(componentLabel, 0, sizeof(uint32_t) * labelNumber);
+
+    for (size_t iy = 0; iy < height; ++iy)
+    {
+        const uint32_t* labelRow     = label + iy * width;
+        const byte_t*   intensityRow = (intensityImage != NULL) ? (ImageRow(*intensityImage, iy)) : (NULL);
+
+        for (size_t ix = 0; ix < width; ++ix)
+        {
+            if ((value = labelRow[ix]) == 0)
+                continue;
+
+            if (componentLabel[value] == 0)
+            {
+                AppendComponent(statistics);
+                componentLabel[value] = statistics->componentNumber;
+            }
+
+            component = componentLabel[value] - 1;
+
+            statistics->area[component]++;
+            statistics->left[component]    = std::min(statistics->left[component], static_cast<uint32_t>(ix));
+            statistics->top[component]     = std::min(statistics->top[component], static_cast<uint32_t>(iy));
+            statistics->right[component]   = std::max(statistics->right[component], static_cast<uint32_t>(ix));
+            statistics->bottom[component]  = static_cast<uint32_t>(iy);
+            statistics->sumX[component]   += ix;
+            statistics->sumY[component]   += iy;
+            statistics->sumXX[component]  += ix * ix;
+            statistics->sumXY[component]  += ix * iy;
+            statistics->sumYY[component]  += iy * iy;
+
+            if (intensityRow != NULL)
+                statistics->sumIntensity[component] += intensityRow[ix];
+
+            if (ix + 1 < width && labelRow[ix + 1] == value)
+                statistics->adjacency[component]++;
+
+            if (iy + 1 < height && labelRow[ix + width] == value)
+                statistics->adjacency[component]++;
+        }
+    }
+
+    return statistics->componentNumber;
+}
+
+uint32_t MeasureLabelRun(const std::vector<LabelRun>& run, const std::vector<size_t>& rowRunIndex, uint32_t componentNumber,
+                         const ImageView* intensityImage, ComponentStatistics* statistics)
+{
+    assert(statistics != NULL);
+    assert(rowRunIndex.empty() == false);
+
+    size_t   prevIndex = 0;
+    uint32_t component = 0;
+    uint64_t length    = 0;
+    uint64_t runSumX   = 0;
+
+    ResetComponentStatistics(statistics, componentNumber);
+
+    for (size_t iy = 0; iy + 1 < rowRunIndex.size(); ++iy)
+    {
+        const byte_t* intensityRow = (intensityImage != NULL) ? (ImageRow(*intensityImage, iy)) : (NULL);
+
+        prevIndex = (iy > 0) ? (rowRunIndex[iy - 1]) : (0);
+
+        for (size_t runIndex = rowRunIndex[iy]; runIndex < rowRunIndex[iy + 1]; ++runIndex)
+        {
+            const LabelRun& currentRun = run[runIndex];
+
+            component = currentRun.label;
+            length    = currentRun.endColumn - currentRun.beginColumn;
+            runSumX   = (static_cast<uint64_t>(currentRun.beginColumn) + currentRun.endColumn - 1) * length / 2;
+
+            statistics->area[component]      += static_cast<uint32_t>(length);
+            statistics->left[component]       = std::min(statistics->left[component], currentRun.beginColumn);
+            statistics->top[component]        = std::min(statistics->top[component], static_cast<uint32_t>(iy));
+            statistics->right[component]      = std::max(statistics->right[component], currentRun.endColumn - 1);
+            statistics->bottom[component]     = static_cast<uint32_t>(iy);
+            statistics->sumX[component]      += runSumX;
+            statistics->sumY[component]      += iy * length;
+            statistics->sumXX[component]     += SumSquare(currentRun.endColumn) - SumSquare(currentRun.beginColumn);
+            statistics->sumXY[component]     += iy * runSumX;
+            statistics->sumYY[component]     += iy * iy * length;
+            statistics->adjacency[component] += static_cast<uint32_t>(length - 1);
+
+            if (intensityRow != NULL)
+                for (uint32_t ix = currentRun.beginColumn; ix < currentRun.endColumn; ++ix)
+                    statistics->sumIntensity[component] += intensityRow[ix];
+
+            // Runs of one component may touch inside a row where the engines split them.
+            if (runIndex > rowRunIndex[iy] && run[runIndex - 1].endColumn == currentRun.beginColumn && run[runIndex - 1].label == component)
+                statistics->adjacency[component]++;
+
+            if (iy == 0)
+                continue;
+
+            while (prevIndex < rowRunIndex[iy] && run[prevIndex].endColumn <= currentRun.beginColumn)
+                ++prevIndex;
+
+            for (size_t overlapIndex = prevIndex; overlapIndex < rowRunIndex[iy] && run[overlapIndex].beginColumn < currentRun.endColumn; ++overlapIndex)
+                if (run[overlapIndex].label == component)
+                    statistics->adjacency[component] += std::min(run[overlapIndex].endColumn, currentRun.endColumn) -
+                                                        std::max(run[overlapIndex].beginColumn, currentRun.beginColumn);
+        }
+    }
+
+    return statistics->componentNumber;
+}
+
+// +------------------------------------------< COMPONENT FILTER >------------------------------------------+
+
+ComponentFilter MakeComponentFilter(void)
+{
+    ComponentFilter filter;
+
+    filter.minArea        = 0;
+    filter.maxArea        = UINT32_MAX;
+    filter.minAspectRatio = 0.0;
+    filter.maxAspectRatio = std::numeric_limits<double>::infinity();
+
+    return filter;
+}
+
+uint32_t SelectComponent(const ComponentStatistics& statistics, const ComponentFilter& filter, byte_t* keepTable)
+{
+    assert(keepTable != NULL);
+
+    uint32_t keptNumber  = 0;
+    double   aspectRatio = 0.0;
+
+    for (uint32_t component = 0; component < statistics.componentNumber; ++component)
+    {
+        aspectRatio = static_cast<double>(statistics.right[component] - statistics.left[component] + 1) /
+                      static_cast<double>(statistics.bottom[component] - statistics.top[component] + 1);
+
+        keepTable[component] = (statistics.area[component] >= filter.minArea && statistics.area[component] <= filter.maxArea &&
+                                aspectRatio >= filter.minAspectRatio && aspectRatio <= filter.maxAspectRatio) ? (255) : (0);
+
+        keptNumber += (keepTable[component] != 0) ? (1) : (0);
+    }
+
+    return keptNumber;
+}
+
+uint32_t FilterComponent(const ImageView& inputImage, const ImageView& outputImage, const ComponentFilter& filter, ComponentStatistics* statistics,
+                         const ImageView* intensityImage, LabelingMode labelingMode, ThreadPool* threadPool, LabelingWorkspace* workspace)
+{
+    assert(inputImage.pointer  != NULL);
+    assert(outputImage.pointer != NULL);
+    assert(statistics          != NULL);
+    assert(IsSameImageSize(inputImage, outputImage));
+    assert(intensityImage == NULL || IsSameImageSize(inputImage, *intensityImage));
+
+    LabelingWorkspace localWorkspace;
+
+    if (workspace == NULL)
+        workspace = &localWorkspace;
+
+    const size_t width     = inputImage.width;
+    const size_t height    = inputImage.height;
+    const size_t labelSize = width * height;
+
+    uint32_t* label          = NULL;
+    uint32_t* componentLabel = NULL;
+    byte_t*   keepTable      = NULL;
+    uint32_t  labelNumber    = 0;
+    uint32_t  passNumber     = 0;
+
+    if (labelingMode == LABELING_MODE_RUN_LENGTH && IsLabelRunFrame(width, height) == false)
+        labelingMode = LABELING_MODE_UNION_FIND;
+
+    if (labelingMode == LABELING_MODE_RUN_LENGTH)
+    {
+        const std::vector<LabelRun>& run = workspace->run;
+
+        auto encode = [&](std::vector<LabelRun>& encodedRun, std::vector<size_t>& rowRunIndex) { EncodeLabelRun(inputImage, encodedRun, rowRunIndex); };
+
+        LabelRunPipeline(workspace, width, height, labelSize, labelSize, intensityImage, statistics, encode);
+
+        keepTable = AcquireWorkspaceBuffer(workspace, workspace->keepTable, statistics->componentNumber + 1);
+
+        SelectComponent(*statistics, filter, keepTable);
+
+        for (size_t iy = 0; iy < height; ++iy)
+            memset(ImageRow(outputImage, iy), 0, sizeof(byte_t) * width);
+
+        for (size_t runIndex = 0; runIndex < run.size(); ++runIndex)
+            if (keepTable[run[runIndex].label] != 0)
+                memset(ImageRow(outputImage, run[runIndex].row) + run[runIndex].beginColumn, 255, run[runIndex].endColumn - run[runIndex].beginColumn);
+
+        return statistics->componentNumber;
+    }
+
+    label          = AcquireWorkspaceBuffer(workspace, workspace->label, labelSize);
+    labelNumber    = LabelImagePlane(inputImage, label, labelingMode, &passNumber, threadPool, workspace);
+    componentLabel = AcquireWorkspaceBuffer(workspace, workspace->renumberedLabel, labelNumber, labelSize + 1);
+
+    MeasureLabelPlane(label, width, height, labelNumber, intensityImage, statistics, componentLabel);
+    FinishComponentStatistics(statistics);
+
+    // Entry 0 stands for the background, component c for entry c + 1 like in 'componentLabel'.
+    keepTable    = AcquireWorkspaceBuffer(workspace, workspace->keepTable, statistics->componentNumber + 1, labelSize + 1);
+    keepTable[0] = 0;
+
+    SelectComponent(*statistics, filter, keepTable + 1);
+
+    for (size_t iy = 0; iy < height; ++iy)
+    {
+        const uint32_t* labelRow  = label + iy * width;
+        byte_t*         outputRow = ImageRow(outputImage, iy);
+
+        for (size_t ix = 0; ix < width; ++ix)
+            outputRow[ix] = keepTable[componentLabel[labelRow[ix]]];
+    }
+
+    return statistics->componentNumber;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,96 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef SEGMENTATION_COMPONENT_STATISTICS_H
+#define SEGMENTATION_COMPONENT_STATISTICS_H
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cinttypes>
+#include <vector>
+
+#include "Segmentation/Image.h"
+#include "Segmentation/Labeling.h"
+#include "Segmentation/ThreadPool.h"
+
+// +------------------------------------------< TYPE DEFINITION >-------------------------------------------+
+
+// Per-component measurements as a struct of arrays, component c at index c. Components are numbered in the raster
+// order of their first pixel, the same for every labeling mode. Bounding boxes are inclusive, the perimeter
+// counts the pixel edges between the component and anything else, the frame border included.
+struct ComponentStatistics
+{
+    uint32_t              componentNumber;
+    std::vector<uint32_t> area;
+    std::vector<uint32_t> left;
+    std::vector<uint32_t> top;
+    std::vector<uint32_t> right;
+    std::vector<uint32_t> bottom;
+    std::vector<uint32_t> perimeter;
+    std::vector<double>   centroidX;
+    std::vector<double>   centroidY;
+    std::vector<double>   momentXX;
+    std::vector<double>   momentXY;
+    std::vector<double>   momentYY;
+    std::vector<double>   meanIntensity;
+
+    // Raw sums the finished measurements are derived from.
+    std::vector<uint64_t> sumX;
+    std::vector<uint64_t> sumY;
+    std::vector<uint64_t> sumXX;
+    std::vector<uint64_t> sumXY;
+    std::vector<uint64_t> sumYY;
+    std::vector<uint64_t> sumIntensity;
+    std::vector<uint32_t> adjacency;
+
+    ComponentStatistics(void) : componentNumber(0) {}
+};
+
+// Components pass when their area and bounding box aspect ratio (width / height) lie in the inclusive ranges.
+struct ComponentFilter
+{
+    uint32_t minArea;
+    uint32_t maxArea;
+    double   minAspectRatio;
+    double   maxAspectRatio;
+};
+
+// +----------------------------------------< COMPONENT STATISTICS >----------------------------------------+
+
+// Clears 'statistics' for 'componentNumber' components without releasing its storage.
+void ResetComponentStatistics(ComponentStatistics* statistics, uint32_t componentNumber);
+
+// Derives perimeter, centroid, central second-order moments (per pixel) and mean intensity from the raw sums.
+void FinishComponentStatistics(ComponentStatistics* statistics);
+
+// Angle in radians between the x axis and the major axis of component 'component'.
+double ComponentOrientation(const ComponentStatistics& statistics, uint32_t component);
+
+// Measures the components of a plane from LabelImagePlane in the pass that numbers them. 'componentLabel' needs
+// 'labelNumber' entries and receives the component number + 1 of every label, 0 for labels not in the plane.
+// 'intensityImage' may be NULL. Returns the component count.
+uint32_t MeasureLabelPlane(const uint32_t* label, size_t width, size_t height, uint32_t labelNumber, const ImageView* intensityImage,
+                           ComponentStatistics* statistics, uint32_t* componentLabel);
+
+// Measures the components of runs from RunLengthLabeling. Only the foreground pixels of 'intensityImage' are read.
+uint32_t MeasureLabelRun(const std::vector<LabelRun>& run, const std::vector<size_t>& rowRunIndex, uint32_t componentNumber,
+                         const ImageView* intensityImage, ComponentStatistics* statistics);
+
+// +------------------------------------------< COMPONENT FILTER >------------------------------------------+
+
+// Filter letting every component through. Narrow its fields to filter.
+ComponentFilter MakeComponentFilter(void);
+
+// Sets 'keepTable[c]' to 255 for the components passing 'filter' and to 0 for the others. Returns the kept count.
+uint32_t SelectComponent(const ComponentStatistics& statistics, const ComponentFilter& filter, byte_t* keepTable);
+
+// Labels 'inputImage', measures every component into 'statistics' and writes the components passing 'filter' to
+// 'outputImage' as 255. The measurements ride along the labeling and the mask pass, so no extra frame pass is
+// made. Unlike Efficient2Pass, the first component is measured and filtered like any other. Returns the
+// component count.
+uint32_t FilterComponent(const ImageView& inputImage, const ImageView& outputImage, const ComponentFilter& filter, ComponentStatistics* statistics,
+                         const ImageView* intensityImage = NULL, LabelingMode labelingMode = LABELING_MODE_UNION_FIND,
+                         ThreadPool* threadPool = NULL, LabelingWorkspace* workspace = NULL);
+
+#endif
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,76 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+#include "Segmentation/CpuFeature.h"
+
+// +--------------------------------------------< CPU FEATURE >---------------------------------------------+
+
+static SimdKernel QuerySimdKernel(void)
+{
+#if defined(SEGMENTATION_X86_64) && defined(_MSC_VER)
+    int cpuInfo[4] = { 0 };
+
+    __cpuid(cpuInfo, 0);
+
+    if (cpuInfo[0] >= 7)
+    {
+        __cpuid(cpuInfo, 1);
+
+        bool osxsave = (cpuInfo[2] & (1 << 27)) != 0;
+        bool avx     = (cpuInfo[2] & (1 << 28)) != 0;
+
+        __cpuidex(cpuInfo, 7, 0);
+
+        bool avx2    = (cpuInfo[1] & (1 << 5)) != 0;
+
+        if (osxsave && avx && avx2 && (_xgetbv(0) & 0x6) == 0x6)
+            return SIMD_KERNEL_AVX2;
+    }
+
+    return SIMD_KERNEL_SSE2;
+#elif defined(SEGMENTATION_X86_64)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+        return SIMD_KERNEL_AVX2;
+
+    return SIMD_KERNEL_SSE2;
+#else
+    return SIMD_KERNEL_SCALAR;
+#endif
+}
+
+SimdKernel DetectSimdKernel(void)
+{
+    static const SimdKernel detectedKernel = QuerySimdKernel();
+
+    return detectedKernel;
+}
+
+SimdKernel ResolveSimdKernel(SimdKernel kernel)
+{
+    SimdKernel detectedKernel = DetectSimdKernel();
+
+    if (kernel == SIMD_KERNEL_AUTO || kernel > detectedKernel)
+        return detectedKernel;
+
+    return kernel;
+}
+
+const char* SimdKernelName(SimdKernel kernel)
+{
+    switch (kernel)
+    {
+        case SIMD_KERNEL_AUTO:   return "auto";
+        case SIMD_KERNEL_SCALAR: return "scalar";
+        case SIMD_KERNEL_SSE2:   return "sse2";
+        case SIMD_KERNEL_AVX2:   return "avx2";
+    }
+
+    return "unknown";
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,40 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef SEGMENTATION_CPU_FEATURE_H
+#define SEGMENTATION_CPU_FEATURE_H
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define SEGMENTATION_X86_64
+#endif
+
+// Kernels for instruction sets above the compile target are built with a per-function target attribute, so the
+// library doesn't need any ISA-specific compiler flag and picks the kernel at runtime.
+#if defined(SEGMENTATION_X86_64) && (defined(__GNUC__) || defined(__clang__))
+    #define SEGMENTATION_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define SEGMENTATION_TARGET_AVX2
+#endif
+
+// +------------------------------------------< TYPE DEFINITION >-------------------------------------------+
+
+enum SimdKernel
+{
+    SIMD_KERNEL_AUTO,
+    SIMD_KERNEL_SCALAR,
+    SIMD_KERNEL_SSE2,
+    SIMD_KERNEL_AVX2
+};
+
+// +--------------------------------------------< CPU FEATURE >---------------------------------------------+
+
+// Best kernel the running CPU supports. Detected once and cached.
+SimdKernel  DetectSimdKernel(void);
+
+// Maps SIMD_KERNEL_AUTO to the detected kernel and degrades a request the CPU can't run to the best one it can.
+SimdKernel  ResolveSimdKernel(SimdKernel kernel);
+
+const char* SimdKernelName(SimdKernel kernel);
+
+#endif
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
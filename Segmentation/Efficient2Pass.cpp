@@ -0,0 +1,901 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cinttypes>
+#include <cstring>
+#include <vector>
+
+#include "Segmentation/Instrumentation.h"
+#include "Segmentation/Labeling.h"
+
+// +-----------------------------------------< LABELING WORKSPACE >-----------------------------------------+
+
+size_t LabelingWorkspaceCapacity(const LabelingWorkspace& workspace)
+{
+    return sizeof(uint32_t) * (workspace.label.capacity() + workspace.prevLabel.capacity() + workspace.equivalence.capacity() +
+                               workspace.sortedLabel.capacity() + workspace.renumberedLabel.capacity() + workspace.labelHistogram.capacity() +
+                               workspace.extractedLabel.capacity() + workspace.extractedAreaSize.capacity() + workspace.candidateLabel.capacity() +
+                               workspace.componentLabel.capacity() + workspace.stripEndLabel.capacity()) +
+           sizeof(size_t) * (workspace.stripBeginRow.capacity() + workspace.rowRunIndex.capacity()) +
+           sizeof(LabelRun) * workspace.run.capacity() + sizeof(ImageRegion) * workspace.region.capacity() +
+           sizeof(byte_t) * workspace.keepTable.capacity() +
+           sizeof(uint16_t) * (workspace.compactLabel.capacity() + workspace.compactEquivalence.capacity());
+}
+
+// +----------------------------------------< UNION-FIND LABELING >-----------------------------------------+
+
+uint32_t FindRootLabel(uint32_t* equivalence, uint32_t label)
+{
+    assert(equivalence != NULL);
+
+    uint32_t root = label;
+    uint32_t next = 0;
+
+    while (equivalence[root] != root)
+        root = equivalence[root];
+
+    while (equivalence[label] != root)
+    {
+        next               = equivalence[label];
+        equivalence[label] = root;
+        label              = next;
+    }
+
+    return root;
+}
+
+uint32_t UnionLabel(uint32_t* equivalence, uint32_t label1, uint32_t label2)
+{
+    assert(equivalence != NULL);
+
+    uint32_t root1 = FindRootLabel(equivalence, label1);
+    uint32_t root2 = FindRootLabel(equivalence, label2);
+
+    // The smaller label always becomes the root so that every component resolves to the label of its first
+    // pixel in raster order, exactly like the minimum propagated by TopDownPass and BottomUpPass.
+    if (root1 < root2)
+    {
+        equivalence[root2] = root1;
+        return root1;
+    }
+
+    equivalence[root1] = root2;
+    return root2;
+}
+
+uint32_t UnionFindLabelStrip(const ImageView& image, uint32_t* label, uint32_t* equivalence, size_t beginRow, size_t endRow, uint32_t firstLabel)
+{
+    assert(image.pointer != NULL);
+    assert(label         != NULL);
+    assert(equivalence   != NULL);
+    assert(beginRow <= endRow && endRow <= image.height);
+
+    const size_t width  = image.width;
+    const size_t height = image.height;
+
+    uint32_t labelNumber = firstLabel;
+    uint32_t minLabel    = 0;
+
+    // TopDownPass and BottomUpPass never visit the first and last column as the center pixel, so the vertical
+    // links inside those columns and the outermost horizontal links of the first and last row don't exist.
+    // The neighbour conditions below reproduce that exact connectivity. Links to the row above 'beginRow' are
+    // left to UnionFindMergeRow.
+    for (size_t iy = beginRow; iy < endRow; ++iy)
+    {
+        const byte_t* row          = ImageRow(image, iy);
+        const byte_t* prevRow      = (iy > beginRow) ? (ImageRow(image, iy - 1)) : (NULL);
+        uint32_t*     labelRow     = label + iy * width;
+        uint32_t*     prevLabelRow = (iy > beginRow) ? (labelRow - width) : (NULL);
+
+        for (size_t ix = 0; ix < width; ++ix)
+        {
+            labelRow[ix] = 0;
+
+            if (row[ix] == 0)
+                continue;
+
+            minLabel = 0;
+
+            if (ix > 0 && row[ix] == row[ix - 1] &&
+                ((iy + 1 < height && ix > 1) || (iy > 0 && ix + 1 < width)))
+                minLabel = labelRow[ix - 1];
+
+            if (prevRow != NULL && ix > 0 && row[ix] == prevRow[ix - 1] &&
+                (ix > 1 || ix + 1 < width))
+                minLabel = (minLabel == 0) ?
+                           (prevLabelRow[ix - 1]) : (UnionLabel(equivalence, minLabel, prevLabelRow[ix - 1]));
+
+            if (prevRow != NULL && ix > 0 && ix + 1 < width && row[ix] == prevRow[ix])
+                minLabel = (minLabel == 0) ?
+                           (prevLabelRow[ix]) : (UnionLabel(equivalence, minLabel, prevLabelRow[ix]));
+
+            if (prevRow != NULL && ix + 1 < width && row[ix] == prevRow[ix + 1] &&
+                (ix + 2 < width || ix > 0))
+                minLabel = (minLabel == 0) ?
+                           (prevLabelRow[ix + 1]) : (UnionLabel(equivalence, minLabel, prevLabelRow[ix + 1]));
+
+            if (minLabel == 0)
+            {
+                minLabel              = labelNumber++;
+                equivalence[minLabel] = minLabel;
+            }
+
+            labelRow[ix] = minLabel;
+        }
+    }
+
+    return labelNumber;
+}
+
+uint32_t UnionFindLabelPass(const ImageView& image, uint32_t* label, uint32_t* equivalence)
+{
+    return UnionFindLabelStrip(image, label, equivalence, 0, image.height, 1);
+}
+
+void UnionFindMergeRow(const ImageView& image, uint32_t* label, uint32_t* equivalence, size_t row)
+{
+    assert(image.pointer != NULL);
+    assert(label         != NULL);
+    assert(equivalence   != NULL);
+    assert(row > 0 && row < image.height);
+
+    const size_t    width        = image.width;
+    const byte_t*   pixelRow     = ImageRow(image, row);
+    const byte_t*   prevPixelRow = ImageRow(image, row - 1);
+    const uint32_t* labelRow     = label + row * width;
+    const uint32_t* prevLabelRow = labelRow - width;
+
+    for (size_t ix = 0; ix < width; ++ix)
+    {
+        if (pixelRow[ix] == 0)
+            continue;
+
+        if (ix > 0 && pixelRow[ix] == prevPixelRow[ix - 1] && (ix > 1 || ix + 1 < width))
+            UnionLabel(equivalence, labelRow[ix], prevLabelRow[ix - 1]);
+
+        if (ix > 0 && ix + 1 < width && pixelRow[ix] == prevPixelRow[ix])
+            UnionLabel(equivalence, labelRow[ix], prevLabelRow[ix]);
+
+        if (ix + 1 < width && pixelRow[ix] == prevPixelRow[ix + 1] && (ix + 2 < width || ix > 0))
+            UnionLabel(equivalence, labelRow[ix], prevLabelRow[ix + 1]);
+    }
+}
+
+uint32_t* UnionFindResolvePass(const ImageView& image, uint32_t* label, uint32_t* equivalence, uint32_t labelNumber)
+{
+    assert(label       != NULL);
+    assert(equivalence != NULL);
+
+    // Roots are always smaller than their children, so a single ascending sweep flattens the whole table.
+    for (uint32_t labelIndex = 1; labelIndex < labelNumber; ++labelIndex)
+        equivalence[labelIndex] = equivalence[equivalence[labelIndex]];
+
+    for (size_t index = 0; index < image.width * image.height; ++index)
+        if (label[index] != 0)
+            label[index] = equivalence[label[index]];
+
+    return label;
+}
+
+// +-----------------------------------------< PARALLEL LABELING >------------------------------------------+
+
+uint32_t ParallelUnionFindLabeling(const ImageView& image, uint32_t* label, uint32_t* equivalence, ThreadPool& threadPool,
+                                   LabelingWorkspace* workspace)
+{
+    assert(image.pointer != NULL);
+    assert(label         != NULL);
+    assert(equivalence   != NULL);
+
+    const size_t width       = image.width;
+    const size_t height      = image.height;
+    const size_t stripNumber = std::max<size_t>(1, std::min(height, threadPool.ThreadNumber() * 2));
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_UNION_FIND, width * height, width * height * (1 + 2 * sizeof(uint32_t)));
+
+    LabelingWorkspace localWorkspace;
+
+    if (workspace == NULL)
+        workspace = &localWorkspace;
+
+    size_t*   beginRow   = AcquireWorkspaceBuffer(workspace, workspace->stripBeginRow, stripNumber + 1);
+    uint32_t* endLabel   = AcquireWorkspaceBuffer(workspace, workspace->stripEndLabel, stripNumber);
+    uint32_t  labelBound = 1;
+
+    for (size_t stripIndex = 0; stripIndex <= stripNumber; ++stripIndex)
+        beginRow[stripIndex] = height * stripIndex / stripNumber;
+
+    // A strip can't create more labels than it has pixels, so starting each strip at its first pixel index keeps
+    // the label ranges disjoint and ordered like the serial raster scan. Min-root unions then resolve every
+    // component to the same relative order the serial engine produces.
+    threadPool.ParallelFor(stripNumber, [&](size_t stripIndex)
+    {
+        endLabel[stripIndex] = UnionFindLabelStrip(image, label, equivalence, beginRow[stripIndex], beginRow[stripIndex + 1],
+                                                   static_cast<uint32_t>(beginRow[stripIndex] * width + 1));
+    });
+
+    for (size_t stripIndex = 1; stripIndex < stripNumber; ++stripIndex)
+        if (beginRow[stripIndex] > 0 && beginRow[stripIndex] < height)
+            UnionFindMergeRow(image, label, equivalence, beginRow[stripIndex]);
+
+    for (size_t stripIndex = 0; stripIndex < stripNumber; ++stripIndex)
+    {
+        for (uint32_t labelIndex = static_cast<uint32_t>(beginRow[stripIndex] * width + 1); labelIndex < endLabel[stripIndex]; ++labelIndex)
+            equivalence[labelIndex] = equivalence[equivalence[labelIndex]];
+
+        labelBound = std::max(labelBound, endLabel[stripIndex]);
+    }
+
+    threadPool.ParallelFor(stripNumber, [&](size_t stripIndex)
+    {
+        for (size_t index = beginRow[stripIndex] * width; index < beginRow[stripIndex + 1] * width; ++index)
+            if (label[index] != 0)
+                label[index] = equivalence[label[index]];
+    });
+
+    return labelBound;
+}
+
+// +------------------------------------------< EFFICIENT 2-PASS >------------------------------------------+
+
+uint32_t* TopDownPass(const ImageView& image, uint32_t* label)
+{
+    assert(image.pointer != NULL);
+    assert(label         != NULL);
+
+    const size_t width  = image.width;
+    const size_t height = image.height;
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_TOP_DOWN_PASS, width * height, width * height * (1 + 2 * sizeof(uint32_t)));
+
+    uint32_t minLabel = 0;
+
+    for (size_t iy = 0; iy + 1 < height; ++iy)
+    {
+        const byte_t* row          = ImageRow(image, iy);
+        const byte_t* nextRow      = ImageRow(image, iy + 1);
+        uint32_t*     labelRow     = label + iy * width;
+        uint32_t*     nextLabelRow = labelRow + width;
+
+        for (size_t ix = 1; ix + 1 < width; ++ix)
+            if (labelRow[ix] != 0)
+            {
+                minLabel = labelRow[ix];
+
+                if (row[ix] == row[ix + 1])
+                {
+                    minLabel = (minLabel < labelRow[ix + 1]) ?
+                               (minLabel) : (labelRow[ix + 1]);
+
+                    labelRow[ix]     = minLabel;
+                    labelRow[ix + 1] = minLabel;
+                }
+
+                if (row[ix] == nextRow[ix + 1])
+                {
+                    minLabel = (minLabel < nextLabelRow[ix + 1]) ?
+                               (minLabel) : (nextLabelRow[ix + 1]);
+
+                    labelRow[ix]         = minLabel;
+                    nextLabelRow[ix + 1] = minLabel;
+                }
+
+                if (row[ix] == nextRow[ix])
+                {
+                    minLabel = (minLabel < nextLabelRow[ix]) ?
+                               (minLabel) : (nextLabelRow[ix]);
+
+                    labelRow[ix]     = minLabel;
+                    nextLabelRow[ix] = minLabel;
+                }
+
+                if (row[ix] == nextRow[ix - 1])
+                {
+                    minLabel = (minLabel < nextLabelRow[ix - 1]) ?
+                               (minLabel) : (nextLabelRow[ix - 1]);
+
+                    labelRow[ix]         = minLabel;
+                    nextLabelRow[ix - 1] = minLabel;
+                }
+            }
+    }
+
+    return label;
+}
+
+uint32_t* BottomUpPass(const ImageView& image, uint32_t* label)
+{
+    assert(image.pointer != NULL);
+    assert(label         != NULL);
+
+    const size_t width  = image.width;
+    const size_t height = image.height;
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_BOTTOM_UP_PASS, width * height, width * height * (1 + 2 * sizeof(uint32_t)));
+
+    uint32_t minLabel = 0;
+
+    if (height < 2 || width < 3)
+        return label;
+
+    for (size_t iy = height - 1; iy > 0; --iy)
+    {
+        const byte_t* row          = ImageRow(image, iy);
+        const byte_t* prevRow      = ImageRow(image, iy - 1);
+        uint32_t*     labelRow     = label + iy * width;
+        uint32_t*     prevLabelRow = labelRow - width;
+
+        for (size_t ix = width - 2; ix > 0; --ix)
+            if (labelRow[ix] != 0)
+            {
+                minLabel = labelRow[ix];
+
+                if (row[ix] == row[ix - 1])
+                {
+                    minLabel = (minLabel < labelRow[ix - 1]) ?
+                               (minLabel) : (labelRow[ix - 1]);
+
+                    labelRow[ix]     = minLabel;
+                    labelRow[ix - 1] = minLabel;
+                }
+
+                if (row[ix] == prevRow[ix - 1])
+                {
+                    minLabel = (minLabel < prevLabelRow[ix - 1]) ?
+                               (minLabel) : (prevLabelRow[ix - 1]);
+
+                    labelRow[ix]         = minLabel;
+                    prevLabelRow[ix - 1] = minLabel;
+                }
+
+                if (row[ix] == prevRow[ix])
+                {
+                    minLabel = (minLabel < prevLabelRow[ix]) ?
+                               (minLabel) : (prevLabelRow[ix]);
+
+                    labelRow[ix]     = minLabel;
+                    prevLabelRow[ix] = minLabel;
+                }
+
+                if (row[ix] == prevRow[ix + 1])
+                {
+                    minLabel = (minLabel < prevLabelRow[ix + 1]) ?
+                               (minLabel) : (prevLabelRow[ix + 1]);
+
+                    labelRow[ix]         = minLabel;
+                    prevLabelRow[ix + 1] = minLabel;
+                }
+            }
+    }
+
+    return label;
+}
+
+uint32_t SortingLabelRenumbering(uint32_t* label, size_t labelSize, uint32_t labelNumber, LabelingWorkspace* workspace)
+{
+    assert(label != NULL);
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_RENUMBERING, labelSize, 3 * sizeof(uint32_t) * labelSize);
+
+    LabelingWorkspace localWorkspace;
+
+    if (workspace == NULL)
+        workspace = &localWorkspace;
+
+    uint32_t* sortedLabel           = NULL;
+    uint32_t* renumberedLabel       = NULL;
+    uint32_t  sortedlabelNumber     = 0;
+    uint32_t  renumberedLabelNumber = 0;
+
+    sortedLabel = AcquireWorkspaceBuffer(workspace, workspace->sortedLabel, labelNumber);
+
+    std::fill(sortedLabel, sortedLabel + labelNumber, 0);
+
+    for (size_t index = 0; index < labelSize; ++index)
+        if (label[index] != 0)
+            sortedLabel[sortedlabelNumber++] = label[index];
+
+    std::sort(sortedLabel, sortedLabel + sortedlabelNumber);
+
+    renumberedLabel                 = AcquireWorkspaceBuffer(workspace, workspace->renumberedLabel, labelNumber);
+    renumberedLabel[sortedLabel[0]] = renumberedLabelNumber++;
+
+    for (unsigned int index = 1; index < sortedlabelNumber; ++index)
+        if (sortedLabel[index] != sortedLabel[index - 1])
+            renumberedLabel[sortedLabel[index]] = renumberedLabelNumber++;
+
+    for (size_t index = 0; index < labelSize; ++index)
+        if (label[index] != 0)
+            label[index] = renumberedLabel[label[index]];
+
+    return renumberedLabelNumber;
+}
+
+uint32_t LabelRenumbering(uint32_t* label, size_t labelSize, uint32_t labelNumber, LabelOrder labelOrder, LabelingWorkspace* workspace)
+{
+    assert(label != NULL);
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_RENUMBERING, labelSize, ((labelOrder == LABEL_ORDER_RASTER) ? (2) : (4)) * sizeof(uint32_t) * labelSize);
+
+    LabelingWorkspace localWorkspace;
+
+    if (workspace == NULL)
+        workspace = &localWorkspace;
+
+    uint32_t* renumberedLabel       = AcquireWorkspaceBuffer(workspace, workspace->renumberedLabel, labelNumber, labelSize + 1);
+    uint32_t* componentArea         = NULL;
+    uint32_t* componentOrder        = NULL;
+    uint32_t* componentRank         = NULL;
+    uint32_t  renumberedLabelNumber = 0;
+
+    // Direct-mapped remap table: every label gets the next number the first time the raster scan meets it. Only
+    // the first 'labelNumber' entries are touched; the pixel bound is reserved so busier frames don't grow it.
+    std::fill(renumberedLabel, renumberedLabel + labelNumber, UINT32_MAX);
+
+    if (labelOrder == LABEL_ORDER_RASTER)
+    {
+        for (size_t index = 0; index < labelSize; ++index)
+            if (label[index] != 0)
+            {
+                if (renumberedLabel[label[index]] == UINT32_MAX)
+                    renumberedLabel[label[index]] = renumberedLabelNumber++;
+
+                label[index] = renumberedLabel[label[index]];
+            }
+
+        // An empty plane still counts one label, as it did with SortingLabelRenumbering.
+        return std::max<uint32_t>(renumberedLabelNumber, 1);
+    }
+
+    componentArea = AcquireWorkspaceBuffer(workspace, workspace->labelHistogram, labelNumber);
+
+    // The first pass stores raster numbers shifted by one, so the background stays apart from the first component.
+    for (size_t index = 0; index < labelSize; ++index)
+        if (label[index] != 0)
+        {
+            if (renumberedLabel[label[index]] == UINT32_MAX)
+            {
+                componentArea[renumberedLabelNumber] = 0;
+                renumberedLabel[label[index]]        = renumberedLabelNumber++;
+            }
+
+            label[index] = renumberedLabel[label[index]] + 1;
+            componentArea[label[index] - 1]++;
+        }
+
+    componentOrder = AcquireWorkspaceBuffer(workspace, workspace->sortedLabel, renumberedLabelNumber, labelNumber);
+    componentRank  = AcquireWorkspaceBuffer(workspace, workspace->componentLabel, renumberedLabelNumber, labelNumber);
+
+    for (uint32_t component = 0; component < renumberedLabelNumber; ++component)
+        componentOrder[component] = component;
+
+    // Larger areas first, raster order among equal areas, so the numbering only depends on the plane.
+    std::sort(componentOrder, componentOrder + renumberedLabelNumber, [componentArea](uint32_t component1, uint32_t component2)
+    {
+        return (componentArea[component1] != componentArea[component2]) ?
+               (componentArea[component1] > componentArea[component2]) : (component1 < component2);
+    });
+
+    for (uint32_t rank = 0; rank < renumberedLabelNumber; ++rank)
+        componentRank[componentOrder[rank]] = rank;
+
+    for (size_t index = 0; index < labelSize; ++index)
+        if (label[index] != 0)
+            label[index] = componentRank[label[index] - 1];
+
+    return std::max<uint32_t>(renumberedLabelNumber, 1);
+}
+
+uint32_t* ExhaustiveSelectLargeAreaLabel(const uint32_t* labelHistogram, uint32_t labelNumber, uint32_t* outputLabel, uint32_t areaExtractNumber,
+                                         LabelingWorkspace* workspace)
+{
+    assert(labelHistogram != NULL);
+    assert(outputLabel    != NULL);
+    assert(areaExtractNumber > 0);
+
+    LabelingWorkspace localWorkspace;
+
+    if (workspace == NULL)
+        workspace = &localWorkspace;
+
+    uint32_t* extractedAreaSize = NULL;
+
+    extractedAreaSize = AcquireWorkspaceBuffer(workspace, workspace->extractedAreaSize, areaExtractNumber);
+
+    std::fill(extractedAreaSize, extractedAreaSize + areaExtractNumber, 0);
+
+    for (unsigned int labelIndex = 0; labelIndex < labelNumber; ++labelIndex)
+        if (labelHistogram[labelIndex] > extractedAreaSize[0])
+        {
+            outputLabel[0]       = labelIndex;
+            extractedAreaSize[0] = labelHistogram[labelIndex];
+        }
+
+    for (unsigned int extractIndex = 1; extractIndex < areaExtractNumber; ++extractIndex)
+        for (unsigned int labelIndex = 0; labelIndex < labelNumber; ++labelIndex)
+            if (labelHistogram[labelIndex] <= extractedAreaSize[extractIndex - 1] && labelIndex != outputLabel[extractIndex - 1])
+                if (labelHistogram[labelIndex] > extractedAreaSize[extractIndex])
+                {
+                    outputLabel[extractIndex]       = labelIndex;
+                    extractedAreaSize[extractIndex] = labelHistogram[labelIndex];
+                }
+
+    return outputLabel;
+}
+
+uint32_t* SelectLargeAreaLabel(const uint32_t* labelHistogram, uint32_t labelNumber, uint32_t* outputLabel, uint32_t areaExtractNumber,
+                               LabelingWorkspace* workspace)
+{
+    assert(labelHistogram != NULL);
+    assert(outputLabel    != NULL);
+    assert(areaExtractNumber > 0);
+
+    LabelingWorkspace localWorkspace;
+
+    if (workspace == NULL)
+        workspace = &localWorkspace;
+
+    std::vector<uint32_t>& candidateLabel = workspace->candidateLabel;
+    size_t                 candidateIndex = 0;
+    uint32_t               extractIndex   = 0;
+
+    // A single scan is all the exhaustive selection needs for one slot.
+    if (areaExtractNumber == 1)
+        return ExhaustiveSelectLargeAreaLabel(labelHistogram, labelNumber, outputLabel, areaExtractNumber, workspace);
+
+    // Larger areas first, smaller labels first among equal areas.
+    auto largerArea = [labelHistogram](uint32_t label1, uint32_t label2)
+    {
+        return (labelHistogram[label1] != labelHistogram[label2]) ?
+               (labelHistogram[label1] > labelHistogram[label2]) : (label1 < label2);
+    };
+
+    // The heap never holds more than K labels, so reserving that up front is the only growth.
+    AcquireWorkspaceBuffer(workspace, candidateLabel, std::min(areaExtractNumber, labelNumber), areaExtractNumber);
+    candidateLabel.clear();
+
+    // Bounded heap of the K best labels seen so far, the worst of them on top. Most labels lose against the top
+    // in a single comparison, which keeps the pass close to a plain scan for small K.
+    for (uint32_t labelIndex = 0; labelIndex < labelNumber; ++labelIndex)
+    {
+        if (labelHistogram[labelIndex] == 0)
+            continue;
+
+        if (candidateLabel.size() < areaExtractNumber)
+        {
+            candidateLabel.push_back(labelIndex);
+            std::push_heap(candidateLabel.begin(), candidateLabel.end(), largerArea);
+        }
+        else if (largerArea(labelIndex, candidateLabel.front()))
+        {
+            std::pop_heap(candidateLabel.begin(), candidateLabel.end(), largerArea);
+            candidateLabel.back() = labelIndex;
+            std::push_heap(candidateLabel.begin(), candidateLabel.end(), largerArea);
+        }
+    }
+
+    std::sort_heap(candidateLabel.begin(), candidateLabel.end(), largerArea);
+
+    // Same picks as ExhaustiveSelectLargeAreaLabel. Each scan only excludes the label picked just before, so
+    // once two labels share the largest remaining area the scans alternate between them for the remaining
+    // slots. Slots left over when every area is taken stay 0.
+    while (extractIndex < areaExtractNumber && candidateIndex < candidateLabel.size())
+    {
+        outputLabel[extractIndex++] = candidateLabel[candidateIndex];
+
+        if (candidateIndex + 1 < candidateLabel.size() &&
+            labelHistogram[candidateLabel[candidateIndex + 1]] == labelHistogram[candidateLabel[candidateIndex]])
+        {
+            for (uint32_t tieIndex = 1; extractIndex < areaExtractNumber; ++tieIndex)
+                outputLabel[extractIndex++] = candidateLabel[candidateIndex + tieIndex % 2];
+        }
+
+        ++candidateIndex;
+    }
+
+    return outputLabel;
+}
+
+byte_t* MakeLabelKeepTable(const uint32_t* extractedLabel, uint32_t areaExtractNumber, uint32_t labelNumber, byte_t* keepTable)
+{
+    assert(extractedLabel != NULL);
+    assert(keepTable      != NULL);
+
+    memset(keepTable, 0, sizeof(byte_t) * labelNumber);
+
+    for (uint32_t extractIndex = 0; extractIndex < areaExtractNumber; ++extractIndex)
+        keepTable[extractedLabel[extractIndex]] = 255;
+
+    return keepTable;
+}
+
+uint32_t* ExtractLargeAreaLabel(uint32_t* inputLabel, size_t labelSize, uint32_t labelNumber, uint32_t* outputLabel, uint32_t areaExtractNumber,
+                                LabelingWorkspace* workspace)
+{
+    assert(inputLabel  != NULL);
+    assert(outputLabel != NULL);
+    assert(areaExtractNumber > 0);
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_AREA_EXTRACTION, labelSize, sizeof(uint32_t) * labelSize);
+
+    LabelingWorkspace localWorkspace;
+
+    if (workspace == NULL)
+        workspace = &localWorkspace;
+
+    uint32_t* labelHistogram = NULL;
+
+    // Renumbered labels never exceed the pixel count, whatever the frame content.
+    labelHistogram = AcquireWorkspaceBuffer(workspace, workspace->labelHistogram, labelNumber, labelSize + 1);
+
+    std::fill(labelHistogram, labelHistogram + labelNumber, 0);
+
+    for (size_t index = 0; index < labelSize; ++index)
+        if (inputLabel[index] != 0)
+            labelHistogram[inputLabel[index]]++;
+
+    SelectLargeAreaLabel(labelHistogram, labelNumber, outputLabel, areaExtractNumber, workspace);
+
+    return outputLabel;
+}
+
+uint32_t LabelImagePlane(const ImageView& image, uint32_t* label, LabelingMode labelingMode, uint32_t* passNumber, ThreadPool* threadPool,
+                         LabelingWorkspace* workspace)
+{
+    assert(image.pointer != NULL);
+    assert(label         != NULL);
+    assert(passNumber    != NULL);
+
+    LabelingWorkspace localWorkspace;
+
+    if (workspace == NULL)
+        workspace = &localWorkspace;
+
+    const size_t width     = image.width;
+    const size_t height    = image.height;
+    const size_t labelSize = width * height;
+
+    uint32_t* prevLabel   = NULL;
+    uint32_t* equivalence = NULL;
+    uint32_t  labelNumber = 1;
+    bool      difference  = false;
+
+    *passNumber = 0;
+
+    // The run-length and compact engines have no 32-bit label plane, their connectivity is the union-find one.
+    if (labelingMode == LABELING_MODE_RUN_LENGTH || labelingMode == LABELING_MODE_COMPACT_UNION_FIND)
+        labelingMode = LABELING_MODE_UNION_FIND;
+
+    if (labelingMode == LABELING_MODE_UNION_FIND || labelingMode == LABELING_MODE_PARALLEL_UNION_FIND)
+    {
+        // The union-find passes write every pixel of the label plane and every entry they read back.
+        equivalence = AcquireWorkspaceBuffer(workspace, workspace->equivalence, labelSize + 1);
+
+        // LabelRenumbering sizes and clears its remap table by the bound handed in, so the engines' own bound keeps
+        // it at the provisional label count instead of the pixel count.
+        if (labelingMode == LABELING_MODE_PARALLEL_UNION_FIND)
+            labelNumber = ParallelUnionFindLabeling(image, label, equivalence, (threadPool != NULL) ? (*threadPool) : (DefaultThreadPool()), workspace);
+        else
+            labelNumber = UnionFindLabeling(image, label, equivalence, CONNECTIVITY_8);
+
+        *passNumber = 2;
+    }
+    else
+    {
+        prevLabel = AcquireWorkspaceBuffer(workspace, workspace->prevLabel, labelSize);
+
+        std::fill(label, label + labelSize, 0);
+
+        for (size_t iy = 0; iy < height; ++iy)
+        {
+            const byte_t* row = ImageRow(image, iy);
+
+            for (size_t ix = 0; ix < width; ++ix)
+                if (row[ix] != 0)
+                    label[iy * width + ix] = labelNumber++;
+        }
+
+        while (true)
+        {
+            memcpy(prevLabel, label, sizeof(uint32_t) * labelSize);
+            difference = false;
+
+            TopDownPass(image, label);
+            BottomUpPass(image, label);
+            *passNumber += 2;
+
+            for (size_t index = 0; index < labelSize; ++index)
+                if (label[index] != prevLabel[index])
+                {
+                    difference = true;
+                    break;
+                }
+
+            if (difference == false)
+                break;
+        }
+    }
+
+    return labelNumber;
+}
+
+// Efficient2Pass on a 16-bit label plane. Returns false, with 'outputImage' untouched, when the frame needs more
+// provisional labels than 16 bits hold.
+static bool CompactEfficient2Pass(const ImageView& inputImage, const ImageView& outputImage, uint32_t areaExtractNumber, LabelingWorkspace* workspace)
+{
+    const size_t width       = inputImage.width;
+    const size_t height      = inputImage.height;
+    const size_t labelSize   = width * height;
+    const size_t compactSize = static_cast<size_t>(UINT16_MAX) + 1;
+
+    uint16_t* label           = AcquireWorkspaceBuffer(workspace, workspace->compactLabel, labelSize);
+    uint16_t* equivalence     = AcquireWorkspaceBuffer(workspace, workspace->compactEquivalence, std::min(labelSize + 1, compactSize));
+    uint32_t* renumberedLabel = NULL;
+    uint32_t* labelHistogram  = NULL;
+    uint32_t* extractedLabel  = NULL;
+    byte_t*   keepTable       = NULL;
+    uint32_t  labelBound      = UnionFindLabeling(inputImage, label, equivalence, CONNECTIVITY_8);
+    uint32_t  labelNumber     = 0;
+
+    if (labelBound == 0)
+        return false;
+
+    renumberedLabel = AcquireWorkspaceBuffer(workspace, workspace->renumberedLabel, labelBound, compactSize);
+    labelHistogram  = AcquireWorkspaceBuffer(workspace, workspace->labelHistogram, labelBound, compactSize);
+    extractedLabel  = AcquireWorkspaceBuffer(workspace, workspace->extractedLabel, areaExtractNumber);
+    keepTable       = AcquireWorkspaceBuffer(workspace, workspace->keepTable, labelBound, compactSize);
+
+    std::fill(labelHistogram, labelHistogram + labelBound, 0);
+    std::fill(extractedLabel, extractedLabel + areaExtractNumber, 0);
+
+    {
+        SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_AREA_EXTRACTION, labelSize, sizeof(uint16_t) * labelSize);
+
+        for (size_t index = 0; index < labelSize; ++index)
+            labelHistogram[label[index]]++;
+
+        // Resolved labels are the roots of the equivalence table, whose values grow in the raster order of their
+        // components. Numbering the roots in ascending order therefore matches LabelRenumbering without another
+        // pass over the plane, and since no root is numbered above its value the areas compact in place.
+        for (uint32_t root = 1; root < labelBound; ++root)
+            if (equivalence[root] == root)
+            {
+                renumberedLabel[root]         = labelNumber;
+                labelHistogram[labelNumber++] = labelHistogram[root];
+            }
+
+        // The first component shares 0 with the background and takes no part in the selection, like it does
+        // after LabelRenumbering.
+        labelHistogram[0] = 0;
+        labelNumber       = std::max<uint32_t>(labelNumber, 1);
+
+        SelectLargeAreaLabel(labelHistogram, labelNumber, extractedLabel, areaExtractNumber, workspace);
+        MakeLabelKeepTable(extractedLabel, areaExtractNumber, labelNumber, keepTable);
+
+        // Spread the keep table from numbers back to roots. Walking down from the largest root never overwrites
+        // a number still to be read.
+        for (uint32_t root = labelBound - 1; root > 0; --root)
+            if (equivalence[root] == root)
+                keepTable[root] = keepTable[renumberedLabel[root]];
+    }
+
+    SEGMENTATION_COUNT(INSTRUMENTATION_COUNTER_COMPONENT, labelNumber);
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_MASK_OUTPUT, labelSize, (sizeof(uint16_t) + sizeof(byte_t)) * labelSize);
+
+    for (size_t iy = 0; iy < height; ++iy)
+    {
+        const uint16_t* labelRow  = label + iy * width;
+        byte_t*         outputRow = ImageRow(outputImage, iy);
+
+        for (size_t ix = 0; ix < width; ++ix)
+            outputRow[ix] = keepTable[labelRow[ix]];
+    }
+
+    return true;
+}
+
+byte_t* Efficient2Pass(const ImageView& inputImage, const ImageView& outputImage, uint32_t areaExtractNumber,
+                       LabelingMode labelingMode, LabelingReport* labelingReport, ThreadPool* threadPool, LabelingWorkspace* workspace)
+{
+    assert(inputImage.pointer  != NULL);
+    assert(outputImage.pointer != NULL);
+    assert(IsSameImageSize(inputImage, outputImage));
+    assert(areaExtractNumber > 0);
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_LABELING, inputImage.width * inputImage.height, 2 * inputImage.width * inputImage.height);
+
+    LabelingWorkspace localWorkspace;
+
+    if (workspace == NULL)
+        workspace = &localWorkspace;
+
+    // Frames too small for the run-length neighbour rules fall back to the union-find engine.
+    if (labelingMode == LABELING_MODE_RUN_LENGTH && (inputImage.width < 3 || inputImage.height < 2))
+        labelingMode = LABELING_MODE_UNION_FIND;
+
+    if (labelingMode == LABELING_MODE_COMPACT_UNION_FIND)
+    {
+        if (CompactEfficient2Pass(inputImage, outputImage, areaExtractNumber, workspace))
+        {
+            SEGMENTATION_COUNT(INSTRUMENTATION_COUNTER_PASS, 2);
+
+            if (labelingReport != NULL)
+            {
+                labelingReport->passNumber          = 2;
+                labelingReport->elapsedMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+            }
+
+            return outputImage.pointer;
+        }
+
+        labelingMode = LABELING_MODE_UNION_FIND;
+    }
+
+    if (labelingMode == LABELING_MODE_RUN_LENGTH)
+    {
+        RunLengthEfficient2Pass(inputImage, outputImage, areaExtractNumber, workspace);
+
+        SEGMENTATION_COUNT(INSTRUMENTATION_COUNTER_PASS, 1);
+
+        if (labelingReport != NULL)
+        {
+            labelingReport->passNumber          = 1;
+            labelingReport->elapsedMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+        }
+
+        return outputImage.pointer;
+    }
+
+    const size_t width     = inputImage.width;
+    const size_t height    = inputImage.height;
+    const size_t labelSize = width * height;
+
+    uint32_t* label          = NULL;
+    uint32_t* extractedLabel = NULL;
+    byte_t*   keepTable      = NULL;
+    uint32_t  labelNumber    = 0;
+    uint32_t  passNumber     = 0;
+
+    label          = AcquireWorkspaceBuffer(workspace, workspace->label, labelSize);
+    extractedLabel = AcquireWorkspaceBuffer(workspace, workspace->extractedLabel, areaExtractNumber);
+
+    std::fill(extractedLabel, extractedLabel + areaExtractNumber, 0);
+
+    labelNumber = LabelImagePlane(inputImage, label, labelingMode, &passNumber, threadPool, workspace);
+
+    labelNumber = LabelRenumbering(label, labelSize, labelNumber, LABEL_ORDER_RASTER, workspace);
+    ExtractLargeAreaLabel(label, labelSize, labelNumber, extractedLabel, areaExtractNumber, workspace);
+
+    keepTable = AcquireWorkspaceBuffer(workspace, workspace->keepTable, labelNumber, labelSize + 1);
+
+    MakeLabelKeepTable(extractedLabel, areaExtractNumber, labelNumber, keepTable);
+
+    SEGMENTATION_COUNT(INSTRUMENTATION_COUNTER_PASS, passNumber);
+    SEGMENTATION_COUNT(INSTRUMENTATION_COUNTER_COMPONENT, labelNumber);
+
+    {
+        SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_MASK_OUTPUT, labelSize, (sizeof(uint32_t) + sizeof(byte_t)) * labelSize);
+
+        for (size_t iy = 0; iy < height; ++iy)
+        {
+            const uint32_t* labelRow  = label + iy * width;
+            byte_t*         outputRow = ImageRow(outputImage, iy);
+
+            for (size_t ix = 0; ix < width; ++ix)
+                outputRow[ix] = keepTable[labelRow[ix]];
+        }
+    }
+
+    if (labelingReport != NULL)
+    {
+        labelingReport->passNumber          = passNumber;
+        labelingReport->elapsedMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    }
+
+    return outputImage.pointer;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,81 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <vector>
+
+#include "Segmentation/Binarization.h"
+#include "Segmentation/FusedSegmentation.h"
+#include "Segmentation/Histogram.h"
+#include "Segmentation/Instrumentation.h"
+
+// +-----------------------------------------< FUSED SEGMENTATION >-----------------------------------------+
+
+byte_t FusedSegmentation(ThresholdMethod thresholdMethod, const ImageView& inputImage, const ImageView& outputImage, uint32_t areaExtractNumber,
+                         ComponentStatistics* statistics, uint32_t* extractedComponent, size_t sampleStride, LabelingWorkspace* workspace)
+{
+    assert(inputImage.pointer  != NULL);
+    assert(outputImage.pointer != NULL);
+    assert(IsSameImageSize(inputImage, outputImage));
+    assert(areaExtractNumber > 0);
+
+    LabelingWorkspace localWorkspace;
+
+    if (workspace == NULL)
+        workspace = &localWorkspace;
+
+    const size_t width  = inputImage.width;
+    const size_t height = inputImage.height;
+
+    uint32_t histogram[256]  = { 0 };
+    uint32_t componentNumber = 0;
+    byte_t   threshold       = 0;
+
+    sampleStride = ClampSampleStride(inputImage, sampleStride);
+
+    ComputeSampledHistogram(inputImage, sampleStride, histogram);
+
+    threshold = SelectThreshold(thresholdMethod, histogram, SampledLength(width, sampleStride), SampledLength(height, sampleStride),
+                                SumImageCorner(inputImage));
+
+    if (IsLabelRunFrame(width, height) == false)
+    {
+        std::vector<byte_t> maskImage(width * height);
+        ImageView           maskView = MakeImageView(maskImage.data(), width, height);
+
+        BinarizeImage(inputImage, maskView, threshold);
+
+        if (statistics != NULL)
+        {
+            uint32_t* label          = AcquireWorkspaceBuffer(workspace, workspace->label, width * height);
+            uint32_t  passNumber     = 0;
+            uint32_t  labelNumber    = LabelImagePlane(maskView, label, LABELING_MODE_UNION_FIND, &passNumber, NULL, workspace);
+            uint32_t* componentLabel = AcquireWorkspaceBuffer(workspace, workspace->renumberedLabel, labelNumber);
+
+            MeasureLabelPlane(label, width, height, labelNumber, &inputImage, statistics, componentLabel);
+            FinishComponentStatistics(statistics);
+        }
+
+        Efficient2Pass(maskView, outputImage, areaExtractNumber, LABELING_MODE_UNION_FIND, NULL, NULL, workspace);
+    }
+    else
+    {
+        auto encode = [&](std::vector<LabelRun>& run, std::vector<size_t>& rowRunIndex)
+        {
+            EncodeThresholdRun(inputImage, threshold, run, rowRunIndex);
+        };
+
+        componentNumber = LabelRunPipeline(workspace, width, height, width * height, width * height, &inputImage, statistics, encode);
+
+        WriteLargeAreaRun(outputImage, componentNumber, areaExtractNumber, workspace);
+
+        SEGMENTATION_COUNT(INSTRUMENTATION_COUNTER_PASS, 1);
+    }
+
+    CopyExtractedComponent(*workspace, areaExtractNumber, extractedComponent);
+
+    return threshold;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
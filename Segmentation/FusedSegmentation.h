@@ -0,0 +1,32 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef SEGMENTATION_FUSED_SEGMENTATION_H
+#define SEGMENTATION_FUSED_SEGMENTATION_H
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cinttypes>
+
+#include "Segmentation/ComponentStatistics.h"
+#include "Segmentation/Image.h"
+#include "Segmentation/Labeling.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +-----------------------------------------< FUSED SEGMENTATION >-----------------------------------------+
+
+// Threshold selection and Efficient2Pass in one call on the grayscale frame. The histogram and threshold search
+// are those of the selector of 'thresholdMethod' (with the sample stride clamped like ThresholdTracker does),
+// after which the components are run-length encoded straight from the 'pixel >= threshold' predicate, so the
+// 0/255 mask is never written nor read back. 'outputImage' receives the 'areaExtractNumber' largest components
+// as 255, byte for byte what the selector followed by Efficient2Pass writes, and may be 'inputImage'.
+// 'statistics', when given, receives the component table of the thresholded frame with the intensities of
+// 'inputImage', numbered like every ComponentStatistics. 'extractedComponent', when given, needs
+// 'areaExtractNumber' entries and receives the extracted component numbers in the slots Efficient2Pass fills;
+// component 0 shares its value with the background there and is never extracted. Returns the threshold.
+byte_t FusedSegmentation(ThresholdMethod thresholdMethod, const ImageView& inputImage, const ImageView& outputImage, uint32_t areaExtractNumber = 1,
+                         ComponentStatistics* statistics = NULL, uint32_t* extractedComponent = NULL, size_t sampleStride = 1,
+                         LabelingWorkspace* workspace = NULL);
+
+#endif
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
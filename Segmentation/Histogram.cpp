@@ -0,0 +1,245 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cassert>
+#include <cinttypes>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #include <immintrin.h>
+#endif
+
+#include "Segmentation/Histogram.h"
+#include "Segmentation/Instrumentation.h"
+
+// +---------------------------------------------< HISTOGRAM >----------------------------------------------+
+
+void MergeSubHistogram(uint32_t (*subHistogram)[256], uint32_t* histogram)
+{
+    assert(subHistogram != NULL);
+    assert(histogram    != NULL);
+
+    for (int brightness = 0; brightness < 256; ++brightness)
+        histogram[brightness] += subHistogram[0][brightness] + subHistogram[1][brightness] +
+                                 subHistogram[2][brightness] + subHistogram[3][brightness];
+}
+
+void AccumulateHistogramRowScalar(const byte_t* row, size_t width, uint32_t (*subHistogram)[256])
+{
+    size_t ix = 0;
+
+    for (; ix + 4 <= width; ix += 4)
+    {
+        subHistogram[0][row[ix]]++;
+        subHistogram[1][row[ix + 1]]++;
+        subHistogram[2][row[ix + 2]]++;
+        subHistogram[3][row[ix + 3]]++;
+    }
+
+    for (; ix < width; ++ix)
+        subHistogram[0][row[ix]]++;
+}
+
+#if defined(SEGMENTATION_X86_64)
+
+static inline void CountEightPixel(uint64_t pixels, uint32_t (*subHistogram)[256])
+{
+    subHistogram[0][pixels         & 0xFF]++;
+    subHistogram[1][(pixels >> 8)  & 0xFF]++;
+    subHistogram[2][(pixels >> 16) & 0xFF]++;
+    subHistogram[3][(pixels >> 24) & 0xFF]++;
+    subHistogram[0][(pixels >> 32) & 0xFF]++;
+    subHistogram[1][(pixels >> 40) & 0xFF]++;
+    subHistogram[2][(pixels >> 48) & 0xFF]++;
+    subHistogram[3][(pixels >> 56)       ]++;
+}
+
+void AccumulateHistogramRowSSE2(const byte_t* row, size_t width, uint32_t (*subHistogram)[256])
+{
+    size_t ix = 0;
+
+    for (; ix + 16 <= width; ix += 16)
+    {
+        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + ix));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(pixels, _mm_set1_epi8(static_cast<char>(row[ix])))) == 0xFFFF)
+        {
+            subHistogram[0][row[ix]] += 16;
+            continue;
+        }
+
+        CountEightPixel(static_cast<uint64_t>(_mm_cvtsi128_si64(pixels)), subHistogram);
+        CountEightPixel(static_cast<uint64_t>(_mm_cvtsi128_si64(_mm_unpackhi_epi64(pixels, pixels))), subHistogram);
+    }
+
+    for (; ix < width; ++ix)
+        subHistogram[0][row[ix]]++;
+}
+
+SEGMENTATION_TARGET_AVX2
+void AccumulateHistogramRowAVX2(const byte_t* row, size_t width, uint32_t (*subHistogram)[256])
+{
+    size_t ix = 0;
+
+    for (; ix + 32 <= width; ix += 32)
+    {
+        __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + ix));
+
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(pixels, _mm256_set1_epi8(static_cast<char>(row[ix])))) == -1)
+        {
+            subHistogram[0][row[ix]] += 32;
+            continue;
+        }
+
+        __m128i lowPixels  = _mm256_castsi256_si128(pixels);
+        __m128i highPixels = _mm256_extracti128_si256(pixels, 1);
+
+        CountEightPixel(static_cast<uint64_t>(_mm_cvtsi128_si64(lowPixels)), subHistogram);
+        CountEightPixel(static_cast<uint64_t>(_mm_extract_epi64(lowPixels, 1)), subHistogram);
+        CountEightPixel(static_cast<uint64_t>(_mm_cvtsi128_si64(highPixels)), subHistogram);
+        CountEightPixel(static_cast<uint64_t>(_mm_extract_epi64(highPixels, 1)), subHistogram);
+    }
+
+    for (; ix < width; ++ix)
+        subHistogram[0][row[ix]]++;
+}
+
+#else
+
+void AccumulateHistogramRowSSE2(const byte_t* row, size_t width, uint32_t (*subHistogram)[256])
+{
+    AccumulateHistogramRowScalar(row, width, subHistogram);
+}
+
+void AccumulateHistogramRowAVX2(const byte_t* row, size_t width, uint32_t (*subHistogram)[256])
+{
+    AccumulateHistogramRowScalar(row, width, subHistogram);
+}
+
+#endif
+
+void AccumulateHistogramRow(const byte_t* row, size_t width, uint32_t (*subHistogram)[256], SimdKernel kernel)
+{
+    switch (kernel)
+    {
+        case SIMD_KERNEL_AVX2: AccumulateHistogramRowAVX2(row, width, subHistogram);   break;
+        case SIMD_KERNEL_SSE2: AccumulateHistogramRowSSE2(row, width, subHistogram);   break;
+        default:               AccumulateHistogramRowScalar(row, width, subHistogram); break;
+    }
+}
+
+void AccumulateHistogramScalar(const ImageView& image, uint32_t* histogram)
+{
+    assert(image.pointer != NULL);
+    assert(histogram     != NULL);
+
+    uint32_t subHistogram[4][256];
+
+    memset(subHistogram, 0, sizeof(subHistogram));
+
+    for (size_t iy = 0; iy < image.height; ++iy)
+        AccumulateHistogramRowScalar(ImageRow(image, iy), image.width, subHistogram);
+
+    MergeSubHistogram(subHistogram, histogram);
+}
+
+void AccumulateHistogramSSE2(const ImageView& image, uint32_t* histogram)
+{
+    assert(image.pointer != NULL);
+    assert(histogram     != NULL);
+
+    uint32_t subHistogram[4][256];
+
+    memset(subHistogram, 0, sizeof(subHistogram));
+
+    for (size_t iy = 0; iy < image.height; ++iy)
+        AccumulateHistogramRowSSE2(ImageRow(image, iy), image.width, subHistogram);
+
+    MergeSubHistogram(subHistogram, histogram);
+}
+
+void AccumulateHistogramAVX2(const ImageView& image, uint32_t* histogram)
+{
+    assert(image.pointer != NULL);
+    assert(histogram     != NULL);
+
+    uint32_t subHistogram[4][256];
+
+    memset(subHistogram, 0, sizeof(subHistogram));
+
+    for (size_t iy = 0; iy < image.height; ++iy)
+        AccumulateHistogramRowAVX2(ImageRow(image, iy), image.width, subHistogram);
+
+    MergeSubHistogram(subHistogram, histogram);
+}
+
+uint32_t* ComputeHistogram(const ImageView& image, uint32_t* histogram, SimdKernel kernel)
+{
+    assert(image.pointer != NULL);
+    assert(histogram     != NULL);
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_HISTOGRAM, image.width * image.height, image.width * image.height);
+
+    memset(histogram, 0, sizeof(uint32_t) * 256);
+
+    switch (ResolveSimdKernel(kernel))
+    {
+        case SIMD_KERNEL_AVX2: AccumulateHistogramAVX2(image, histogram);   break;
+        case SIMD_KERNEL_SSE2: AccumulateHistogramSSE2(image, histogram);   break;
+        default:               AccumulateHistogramScalar(image, histogram); break;
+    }
+
+    return histogram;
+}
+
+uint32_t* ComputeSampledHistogram(const ImageView& image, size_t sampleStride, uint32_t* histogram, SimdKernel kernel)
+{
+    assert(image.pointer != NULL);
+    assert(histogram     != NULL);
+    assert(sampleStride > 0);
+
+    if (sampleStride == 1)
+        return ComputeHistogram(image, histogram, kernel);
+
+    const size_t width = image.width;
+    const size_t step  = sampleStride;
+
+    // Every lattice row is fetched whole, the skipped columns share its cache lines.
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_HISTOGRAM, SampledLength(width, step) * SampledLength(image.height, step),
+                       SampledLength(image.height, step) * width);
+
+    uint32_t subHistogram[4][256];
+
+    memset(subHistogram, 0, sizeof(subHistogram));
+    memset(histogram, 0, sizeof(uint32_t) * 256);
+
+    // Strided samples defeat the SIMD kernels, so the lattice is counted with the scalar interleaving only.
+    for (size_t iy = 0; iy < image.height; iy += step)
+    {
+        const byte_t* row = ImageRow(image, iy);
+        size_t        ix  = 0;
+
+        for (; ix + 3 * step < width; ix += 4 * step)
+        {
+            subHistogram[0][row[ix]]++;
+            subHistogram[1][row[ix + step]]++;
+            subHistogram[2][row[ix + 2 * step]]++;
+            subHistogram[3][row[ix + 3 * step]]++;
+        }
+
+        for (; ix < width; ix += step)
+            subHistogram[0][row[ix]]++;
+    }
+
+    MergeSubHistogram(subHistogram, histogram);
+
+    return histogram;
+}
+
+size_t SampledLength(size_t length, size_t sampleStride)
+{
+    assert(sampleStride > 0);
+
+    return (length + sampleStride - 1) / sampleStride;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,42 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef SEGMENTATION_HISTOGRAM_H
+#define SEGMENTATION_HISTOGRAM_H
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cinttypes>
+
+#include "Segmentation/CpuFeature.h"
+#include "Segmentation/Image.h"
+
+// +---------------------------------------------< HISTOGRAM >----------------------------------------------+
+
+// Fills 'histogram[256]' with the brightness counts of 'image'. Counters are 32-bit, so a single call covers up
+// to 2^32 - 1 pixels per bin.
+uint32_t* ComputeHistogram(const ImageView& image, uint32_t* histogram, SimdKernel kernel = SIMD_KERNEL_AUTO);
+
+// Fills 'histogram[256]' from the lattice of every 'sampleStride'-th pixel of every 'sampleStride'-th row, starting
+// at the top-left pixel. The lattice is SampledLength(width) by SampledLength(height) pixels, and a stride of 1
+// is ComputeHistogram.
+uint32_t* ComputeSampledHistogram(const ImageView& image, size_t sampleStride, uint32_t* histogram, SimdKernel kernel = SIMD_KERNEL_AUTO);
+size_t    SampledLength(size_t length, size_t sampleStride);
+
+// Kernels behind ComputeHistogram. Each one adds the counts of 'image' to 'histogram'. Four interleaved
+// sub-histograms keep neighbouring equal pixels from serializing on the same counter, and the SIMD kernels
+// count a whole register at once when all of its pixels are equal.
+void AccumulateHistogramScalar(const ImageView& image, uint32_t* histogram);
+void AccumulateHistogramSSE2(const ImageView& image, uint32_t* histogram);
+void AccumulateHistogramAVX2(const ImageView& image, uint32_t* histogram);
+
+// Row kernels for callers that fuse histogramming into their own pass. They count into four sub-histograms
+// that MergeSubHistogram later adds into a single 256-bin histogram.
+void AccumulateHistogramRowScalar(const byte_t* row, size_t width, uint32_t (*subHistogram)[256]);
+void AccumulateHistogramRowSSE2(const byte_t* row, size_t width, uint32_t (*subHistogram)[256]);
+void AccumulateHistogramRowAVX2(const byte_t* row, size_t width, uint32_t (*subHistogram)[256]);
+void AccumulateHistogramRow(const byte_t* row, size_t width, uint32_t (*subHistogram)[256], SimdKernel kernel);
+void MergeSubHistogram(uint32_t (*subHistogram)[256], uint32_t* histogram);
+
+#endif
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
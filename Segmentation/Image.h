@@ -0,0 +1,91 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef SEGMENTATION_IMAGE_H
+#define SEGMENTATION_IMAGE_H
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cassert>
+#include <cinttypes>
+#include <cstddef>
+
+// +------------------------------------------< TYPE DEFINITION >-------------------------------------------+
+
+typedef uint8_t byte_t;
+
+// Non-owning view of an 8-bit single channel frame. Rows are 'stride' bytes apart, which lets a view address a
+// sub-region of a larger buffer without copying it.
+struct ImageView
+{
+    byte_t* pointer;
+    size_t  width;
+    size_t  height;
+    size_t  stride;
+};
+
+// Rectangle of 'width * height' pixels at column 'left' and row 'top' of a frame.
+struct ImageRegion
+{
+    size_t left;
+    size_t top;
+    size_t width;
+    size_t height;
+};
+
+// +---------------------------------------------< IMAGE VIEW >---------------------------------------------+
+
+inline ImageView MakeImageView(byte_t* pointer, size_t width, size_t height, size_t stride = 0)
+{
+    assert(pointer != NULL);
+    assert(stride == 0 || stride >= width);
+
+    ImageView image;
+
+    image.pointer = pointer;
+    image.width   = width;
+    image.height  = height;
+    image.stride  = (stride == 0) ? (width) : (stride);
+
+    return image;
+}
+
+inline byte_t* ImageRow(const ImageView& image, size_t iy)
+{
+    assert(image.pointer != NULL);
+    assert(iy < image.height);
+
+    return image.pointer + iy * image.stride;
+}
+
+inline bool IsSameImageSize(const ImageView& image1, const ImageView& image2)
+{
+    return image1.width == image2.width && image1.height == image2.height;
+}
+
+// +--------------------------------------------< IMAGE REGION >--------------------------------------------+
+
+inline ImageRegion MakeImageRegion(size_t left, size_t top, size_t width, size_t height)
+{
+    ImageRegion region;
+
+    region.left   = left;
+    region.top    = top;
+    region.width  = width;
+    region.height = height;
+
+    return region;
+}
+
+// View of 'region' inside 'image', sharing its pixels. The region must lie inside the frame.
+inline ImageView CropImageView(const ImageView& image, const ImageRegion& region)
+{
+    assert(image.pointer != NULL);
+    assert(region.width > 0 && region.height > 0);
+    assert(region.left + region.width <= image.width && region.top + region.height <= image.height);
+
+    return MakeImageView(image.pointer + region.top * image.stride + region.left, region.width, region.height, image.stride);
+}
+
+#endif
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,279 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cinttypes>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+#include "Segmentation/Instrumentation.h"
+
+// +------------------------------------------< TYPE DEFINITION >-------------------------------------------+
+
+struct StageCounter
+{
+    std::atomic<uint64_t> callNumber;
+    std::atomic<uint64_t> nanoseconds;
+    std::atomic<uint64_t> pixelNumber;
+    std::atomic<uint64_t> byteNumber;
+};
+
+// Counters of one thread, registered for as long as the thread runs. Only the owning thread writes them, other
+// threads read them when a report sums every thread.
+struct ThreadInstrumentation
+{
+    StageCounter          stage[INSTRUMENTATION_STAGE_NUMBER];
+    std::atomic<uint64_t> counter[INSTRUMENTATION_COUNTER_NUMBER];
+    uint32_t              threadIndex;
+
+    ThreadInstrumentation(void);
+    ~ThreadInstrumentation(void);
+};
+
+struct InstrumentationEvent
+{
+    InstrumentationStage stage;
+    uint32_t             threadIndex;
+    uint64_t             beginTime;
+    uint64_t             endTime;
+    uint64_t             pixelNumber;
+    uint64_t             byteNumber;
+};
+
+struct InstrumentationRegistry
+{
+    std::mutex                          mutex;
+    std::vector<ThreadInstrumentation*> thread;
+    InstrumentationReport               exitedThread;
+    uint32_t                            threadNumber;
+    std::vector<InstrumentationEvent>   event;
+    std::atomic<bool>                   tracing;
+    uint64_t                            traceBeginTime;
+
+    InstrumentationRegistry(void) : exitedThread(), threadNumber(0), tracing(false), traceBeginTime(0) {}
+};
+
+// +------------------------------------------< INSTRUMENTATION >-------------------------------------------+
+
+static InstrumentationRegistry& Registry(void)
+{
+    // Never destroyed: the workers of a static thread pool exit, and hand in their counters, during static
+    // destruction.
+    static InstrumentationRegistry* registry = new InstrumentationRegistry();
+
+    return *registry;
+}
+
+static ThreadInstrumentation& LocalInstrumentation(void)
+{
+    static thread_local ThreadInstrumentation instrumentation;
+
+    return instrumentation;
+}
+
+// Single-writer addition, which needs no locked instruction.
+static inline void AddCounter(std::atomic<uint64_t>& counter, uint64_t value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+static void AccumulateInstrumentation(const ThreadInstrumentation& instrumentation, InstrumentationReport* report)
+{
+    for (int stage = 0; stage < INSTRUMENTATION_STAGE_NUMBER; ++stage)
+    {
+        report->stage[stage].callNumber  += instrumentation.stage[stage].callNumber.load(std::memory_order_relaxed);
+        report->stage[stage].nanoseconds += instrumentation.stage[stage].nanoseconds.load(std::memory_order_relaxed);
+        report->stage[stage].pixelNumber += instrumentation.stage[stage].pixelNumber.load(std::memory_order_relaxed);
+        report->stage[stage].byteNumber  += instrumentation.stage[stage].byteNumber.load(std::memory_order_relaxed);
+    }
+
+    for (int counter = 0; counter < INSTRUMENTATION_COUNTER_NUMBER; ++counter)
+        report->counter[counter] += instrumentation.counter[counter].load(std::memory_order_relaxed);
+}
+
+static void ClearInstrumentation(ThreadInstrumentation* instrumentation)
+{
+    for (int stage = 0; stage < INSTRUMENTATION_STAGE_NUMBER; ++stage)
+    {
+        instrumentation->stage[stage].callNumber.store(0, std::memory_order_relaxed);
+        instrumentation->stage[stage].nanoseconds.store(0, std::memory_order_relaxed);
+        instrumentation->stage[stage].pixelNumber.store(0, std::memory_order_relaxed);
+        instrumentation->stage[stage].byteNumber.store(0, std::memory_order_relaxed);
+    }
+
+    for (int counter = 0; counter < INSTRUMENTATION_COUNTER_NUMBER; ++counter)
+        instrumentation->counter[counter].store(0, std::memory_order_relaxed);
+}
+
+ThreadInstrumentation::ThreadInstrumentation(void)
+{
+    InstrumentationRegistry& registry = Registry();
+
+    ClearInstrumentation(this);
+
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    threadIndex = registry.threadNumber++;
+    registry.thread.push_back(this);
+}
+
+ThreadInstrumentation::~ThreadInstrumentation(void)
+{
+    InstrumentationRegistry& registry = Registry();
+
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    AccumulateInstrumentation(*this, &registry.exitedThread);
+    registry.thread.erase(std::find(registry.thread.begin(), registry.thread.end(), this));
+}
+
+bool InstrumentationEnabled(void)
+{
+#if defined(SEGMENTATION_INSTRUMENTATION)
+    return true;
+#else
+    return false;
+#endif
+}
+
+const char* InstrumentationStageName(InstrumentationStage stage)
+{
+    static const char* const STAGE_NAME[INSTRUMENTATION_STAGE_NUMBER] =
+    {
+        "histogram", "threshold search", "binarization", "labeling", "union-find", "top-down pass", "bottom-up pass",
+        "run-length", "renumbering", "area extraction", "mask output", "morphology"
+    };
+
+    assert(stage >= 0 && stage < INSTRUMENTATION_STAGE_NUMBER);
+
+    return STAGE_NAME[stage];
+}
+
+const char* InstrumentationCounterName(InstrumentationCounter counter)
+{
+    static const char* const COUNTER_NAME[INSTRUMENTATION_COUNTER_NUMBER] = { "passes", "components" };
+
+    assert(counter >= 0 && counter < INSTRUMENTATION_COUNTER_NUMBER);
+
+    return COUNTER_NAME[counter];
+}
+
+InstrumentationReport ReadThreadInstrumentation(void)
+{
+    InstrumentationReport report = InstrumentationReport();
+
+    AccumulateInstrumentation(LocalInstrumentation(), &report);
+
+    return report;
+}
+
+InstrumentationReport ReadInstrumentation(void)
+{
+    InstrumentationRegistry& registry = Registry();
+    InstrumentationReport    report   = InstrumentationReport();
+
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    report = registry.exitedThread;
+
+    for (size_t threadIndex = 0; threadIndex < registry.thread.size(); ++threadIndex)
+        AccumulateInstrumentation(*registry.thread[threadIndex], &report);
+
+    return report;
+}
+
+void ResetInstrumentation(void)
+{
+    InstrumentationRegistry& registry = Registry();
+
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    registry.exitedThread = InstrumentationReport();
+
+    for (size_t threadIndex = 0; threadIndex < registry.thread.size(); ++threadIndex)
+        ClearInstrumentation(registry.thread[threadIndex]);
+}
+
+void StartInstrumentationTrace(void)
+{
+    InstrumentationRegistry& registry = Registry();
+
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    registry.event.clear();
+    registry.traceBeginTime = InstrumentationClock();
+    registry.tracing.store(true, std::memory_order_relaxed);
+}
+
+bool StopInstrumentationTrace(const char* fileName)
+{
+    assert(fileName != NULL);
+
+    InstrumentationRegistry&          registry = Registry();
+    std::vector<InstrumentationEvent> event;
+    uint64_t                          traceBeginTime = 0;
+    FILE*                             file           = NULL;
+    bool                              written        = false;
+
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        registry.tracing.store(false, std::memory_order_relaxed);
+        registry.event.swap(event);
+        traceBeginTime = registry.traceBeginTime;
+    }
+
+    file = fopen(fileName, "w");
+
+    if (file == NULL)
+        return false;
+
+    // Complete ("X") events on microsecond timestamps, one track per thread. Scopes begun before the trace
+    // started keep their true begin, slightly before the origin.
+    fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+    for (size_t eventIndex = 0; eventIndex < event.size(); ++eventIndex)
+        fprintf(file, "%s\n{\"name\":\"%s\",\"cat\":\"segmentation\",\"ph\":\"X\",\"pid\":0,\"tid\":%" PRIu32 ",\"ts\":%.3f,\"dur\":%.3f,"
+                "\"args\":{\"pixelNumber\":%" PRIu64 ",\"byteNumber\":%" PRIu64 "}}",
+                (eventIndex == 0) ? ("") : (","), InstrumentationStageName(event[eventIndex].stage), event[eventIndex].threadIndex,
+                (static_cast<double>(event[eventIndex].beginTime) - static_cast<double>(traceBeginTime)) / 1000.0,
+                static_cast<double>(event[eventIndex].endTime - event[eventIndex].beginTime) / 1000.0,
+                event[eventIndex].pixelNumber, event[eventIndex].byteNumber);
+
+    fprintf(file, "\n]}\n");
+
+    written = (ferror(file) == 0);
+
+    return (fclose(file) == 0) && written;
+}
+
+void CountInstrumentation(InstrumentationCounter counter, uint64_t value)
+{
+    AddCounter(LocalInstrumentation().counter[counter], value);
+}
+
+void RecordInstrumentationScope(InstrumentationStage stage, uint64_t pixelNumber, uint64_t byteNumber, uint64_t beginTime, uint64_t endTime)
+{
+    ThreadInstrumentation&   instrumentation = LocalInstrumentation();
+    InstrumentationRegistry& registry        = Registry();
+    StageCounter&            stageCounter    = instrumentation.stage[stage];
+
+    AddCounter(stageCounter.callNumber, 1);
+    AddCounter(stageCounter.nanoseconds, endTime - beginTime);
+    AddCounter(stageCounter.pixelNumber, pixelNumber);
+    AddCounter(stageCounter.byteNumber, byteNumber);
+
+    if (registry.tracing.load(std::memory_order_relaxed))
+    {
+        InstrumentationEvent event = { stage, instrumentation.threadIndex, beginTime, endTime, pixelNumber, byteNumber };
+
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        if (registry.tracing.load(std::memory_order_relaxed))
+            registry.event.push_back(event);
+    }
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,123 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef SEGMENTATION_INSTRUMENTATION_H
+#define SEGMENTATION_INSTRUMENTATION_H
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <chrono>
+#include <cinttypes>
+
+// Stage scopes and counters compile to nothing unless the library is built with SEGMENTATION_INSTRUMENTATION
+// defined (the CMake option of the same name). The functions below exist in both builds and report zeros when
+// the scopes are compiled out.
+#if defined(SEGMENTATION_INSTRUMENTATION)
+    #define SEGMENTATION_SCOPE_NAME_(line)                        instrumentationScope##line
+    #define SEGMENTATION_SCOPE_NAME(line)                         SEGMENTATION_SCOPE_NAME_(line)
+    #define SEGMENTATION_SCOPE(stage, pixelNumber, byteNumber)    InstrumentationScope SEGMENTATION_SCOPE_NAME(__LINE__)(stage, pixelNumber, byteNumber)
+    #define SEGMENTATION_COUNT(counter, value)                    CountInstrumentation(counter, value)
+#else
+    #define SEGMENTATION_SCOPE(stage, pixelNumber, byteNumber)
+    #define SEGMENTATION_COUNT(counter, value)
+#endif
+
+// +------------------------------------------< TYPE DEFINITION >-------------------------------------------+
+
+// Timed stages of the pipeline. LABELING spans a whole Efficient2Pass call and so includes the labeling stages
+// after it, the others don't nest.
+enum InstrumentationStage
+{
+    INSTRUMENTATION_STAGE_HISTOGRAM,
+    INSTRUMENTATION_STAGE_THRESHOLD_SEARCH,
+    INSTRUMENTATION_STAGE_BINARIZATION,
+    INSTRUMENTATION_STAGE_LABELING,
+    INSTRUMENTATION_STAGE_UNION_FIND,
+    INSTRUMENTATION_STAGE_TOP_DOWN_PASS,
+    INSTRUMENTATION_STAGE_BOTTOM_UP_PASS,
+    INSTRUMENTATION_STAGE_RUN_LENGTH,
+    INSTRUMENTATION_STAGE_RENUMBERING,
+    INSTRUMENTATION_STAGE_AREA_EXTRACTION,
+    INSTRUMENTATION_STAGE_MASK_OUTPUT,
+    INSTRUMENTATION_STAGE_MORPHOLOGY,
+    INSTRUMENTATION_STAGE_NUMBER
+};
+
+enum InstrumentationCounter
+{
+    INSTRUMENTATION_COUNTER_PASS,
+    INSTRUMENTATION_COUNTER_COMPONENT,
+    INSTRUMENTATION_COUNTER_NUMBER
+};
+
+// 'byteNumber' estimates the memory a stage reads and writes from its loop structure, not from hardware counters.
+struct InstrumentationStageReport
+{
+    uint64_t callNumber;
+    uint64_t nanoseconds;
+    uint64_t pixelNumber;
+    uint64_t byteNumber;
+};
+
+struct InstrumentationReport
+{
+    InstrumentationStageReport stage[INSTRUMENTATION_STAGE_NUMBER];
+    uint64_t                   counter[INSTRUMENTATION_COUNTER_NUMBER];
+};
+
+// +------------------------------------------< INSTRUMENTATION >-------------------------------------------+
+
+// True when the library was built with the stage scopes in.
+bool InstrumentationEnabled(void);
+
+const char* InstrumentationStageName(InstrumentationStage stage);
+const char* InstrumentationCounterName(InstrumentationCounter counter);
+
+// Counters live per thread and are only ever written by their own thread, so a scope costs two clock reads and
+// a few uncontended additions. ReadThreadInstrumentation returns the calling thread's totals, which after a
+// ResetInstrumentation make a per-call report of serial work. ReadInstrumentation sums every thread, those of
+// the thread pools and the ones that already exited included. Reset between calls, not while a stage runs.
+InstrumentationReport ReadThreadInstrumentation(void);
+InstrumentationReport ReadInstrumentation(void);
+void                  ResetInstrumentation(void);
+
+// Between these calls every scope of every thread is also recorded as a complete event, which
+// StopInstrumentationTrace writes as Chrome trace JSON for chrome://tracing or Perfetto. Recording takes a lock
+// per scope. Returns false when the file can't be written, the recorded events are dropped either way.
+void StartInstrumentationTrace(void);
+bool StopInstrumentationTrace(const char* fileName);
+
+void CountInstrumentation(InstrumentationCounter counter, uint64_t value);
+void RecordInstrumentationScope(InstrumentationStage stage, uint64_t pixelNumber, uint64_t byteNumber, uint64_t beginTime, uint64_t endTime);
+
+inline uint64_t InstrumentationClock(void)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// Times the enclosing block as one call of 'stage'. Use it through SEGMENTATION_SCOPE.
+class InstrumentationScope
+{
+public:
+    InstrumentationScope(InstrumentationStage stage, uint64_t pixelNumber, uint64_t byteNumber)
+        : stage(stage), pixelNumber(pixelNumber), byteNumber(byteNumber), beginTime(InstrumentationClock())
+    {
+    }
+
+    ~InstrumentationScope(void)
+    {
+        RecordInstrumentationScope(stage, pixelNumber, byteNumber, beginTime, InstrumentationClock());
+    }
+
+    InstrumentationScope(const InstrumentationScope&)            = delete;
+    InstrumentationScope& operator=(const InstrumentationScope&) = delete;
+
+private:
+    InstrumentationStage stage;
+    uint64_t             pixelNumber;
+    uint64_t             byteNumber;
+    uint64_t             beginTime;
+};
+
+#endif
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,147 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cassert>
+#include <cinttypes>
+
+#include "Segmentation/Binarization.h"
+#include "Segmentation/Histogram.h"
+#include "Segmentation/Instrumentation.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +-----------------------------------< ITERATIVE THRESHOLD SELECTION >------------------------------------+
+
+byte_t InitIterativeThresholdSelection(const ImageView& image)
+{
+    assert(image.pointer != NULL);
+    assert(image.width > 2 && image.height > 2);
+
+    const byte_t* firstRow = ImageRow(image, 0);
+    const byte_t* lastRow  = ImageRow(image, image.height - 1);
+
+    double foregroundMean = 0.0;
+    double backgroundMean = 0.0;
+
+    for (size_t iy = 0; iy < image.height; ++iy)
+    {
+        const byte_t* row = ImageRow(image, iy);
+
+        for (size_t ix = 0; ix < image.width; ++ix)
+            foregroundMean += row[ix];
+    }
+
+    backgroundMean += firstRow[0] + firstRow[image.width - 1] + lastRow[0] + lastRow[image.width - 1];
+    foregroundMean -= backgroundMean;
+
+    foregroundMean /= static_cast<double>((image.width - 2) * (image.height - 2));
+    backgroundMean /= 4.0;
+
+    return static_cast<byte_t>((foregroundMean + backgroundMean) / 2.0 + 0.5);
+}
+
+byte_t ComputeIterativeThresholdSelection(uint32_t* histogram, byte_t threshold)
+{
+    assert(histogram != NULL);
+
+    double   foregroundMean   = 0.0;
+    double   backgroundMean   = 0.0;
+    uint32_t foregroundNumber = 0;
+    uint32_t backgroundNumber = 0;
+
+    for (int brightness = 0; brightness <= threshold; ++brightness)
+    {
+        foregroundMean   += histogram[brightness] * brightness;
+        foregroundNumber += histogram[brightness];
+    }
+
+    for (int brightness = threshold + 1; brightness < 256; ++brightness)
+    {
+        backgroundMean   += histogram[brightness] * brightness;
+        backgroundNumber += histogram[brightness];
+    }
+
+    // A frame of a single brightness leaves one class empty at any threshold; the threshold is then final.
+    if (foregroundNumber == 0 || backgroundNumber == 0)
+        return threshold;
+
+    foregroundMean /= foregroundNumber;
+    backgroundMean /= backgroundNumber;
+
+    return static_cast<byte_t>((foregroundMean + backgroundMean) / 2.0 + 0.5);
+}
+
+uint32_t SumImageCorner(const ImageView& image)
+{
+    assert(image.pointer != NULL);
+    assert(image.width > 0 && image.height > 0);
+
+    const byte_t* firstRow = ImageRow(image, 0);
+    const byte_t* lastRow  = ImageRow(image, image.height - 1);
+
+    return firstRow[0] + firstRow[image.width - 1] + lastRow[0] + lastRow[image.width - 1];
+}
+
+byte_t InitIterativeThresholdSelection(const uint32_t* histogram, size_t width, size_t height, uint32_t cornerSum)
+{
+    assert(histogram != NULL);
+    assert(width > 2 && height > 2);
+
+    double foregroundMean = 0.0;
+    double backgroundMean = cornerSum;
+
+    for (int brightness = 0; brightness < 256; ++brightness)
+        foregroundMean += static_cast<double>(histogram[brightness]) * brightness;
+
+    foregroundMean -= backgroundMean;
+
+    foregroundMean /= static_cast<double>((width - 2) * (height - 2));
+    backgroundMean /= 4.0;
+
+    return static_cast<byte_t>((foregroundMean + backgroundMean) / 2.0 + 0.5);
+}
+
+byte_t IterativeThresholdSearch(uint32_t* histogram, byte_t initialThreshold)
+{
+    assert(histogram != NULL);
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_THRESHOLD_SEARCH, 0, sizeof(uint32_t) * 256);
+
+    byte_t threshold     = initialThreshold;
+    byte_t prevThreshold = 0;
+
+    while (true)
+    {
+        prevThreshold = threshold;
+        threshold     = ComputeIterativeThresholdSelection(histogram, prevThreshold);
+
+        if (threshold == prevThreshold)
+            break;
+    }
+
+    return threshold;
+}
+
+byte_t IterativeThresholdSelection(const ImageView& inputImage, const ImageView& outputImage, size_t sampleStride)
+{
+    assert(inputImage.pointer  != NULL);
+    assert(outputImage.pointer != NULL);
+    assert(IsSameImageSize(inputImage, outputImage));
+
+    uint32_t histogram[256] = { 0 };
+    byte_t   threshold      = 0;
+
+    sampleStride = ClampSampleStride(inputImage, sampleStride);
+
+    ComputeSampledHistogram(inputImage, sampleStride, histogram);
+
+    // Seeding from the histogram gives the same value as InitIterativeThresholdSelection(inputImage) without
+    // another pass over the frame. A sampled histogram seeds with the lattice size and the frame corners.
+    threshold = InitIterativeThresholdSelection(histogram, SampledLength(inputImage.width, sampleStride),
+                                                SampledLength(inputImage.height, sampleStride), SumImageCorner(inputImage));
+    threshold = IterativeThresholdSearch(histogram, threshold);
+
+    BinarizeImage(inputImage, outputImage, threshold);
+
+    return threshold;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,138 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cassert>
+#include <cfloat>
+#include <cinttypes>
+#include <cmath>
+#include <limits>
+
+#include "Segmentation/Binarization.h"
+#include "Segmentation/Histogram.h"
+#include "Segmentation/Instrumentation.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +-------------------------------------< KAPUR THRESHOLD SELECTION >--------------------------------------+
+
+byte_t ExhaustiveKapurThresholdSearch(const double* histogram)
+{
+    assert(histogram != NULL);
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_THRESHOLD_SEARCH, 0, sizeof(double) * 256);
+
+    double   entropy[256]     = { 0.0 };
+
+    uint32_t foregroundNumber = 0;
+    uint32_t backgroundNumber = 0;
+
+    byte_t   kapurThreshold   = 0;
+    double   maxEntropy       = DBL_MIN;
+
+    for (int brightness = 0; brightness < 256; ++brightness)
+        backgroundNumber += histogram[brightness];
+
+    for (int threshold = 0; threshold < 256; ++threshold)
+    {
+        foregroundNumber += histogram[threshold];
+        backgroundNumber -= histogram[threshold];
+
+        for (int brightness = 0; brightness <= threshold; ++brightness)
+            if (histogram[brightness] / foregroundNumber != 0)
+                entropy[threshold] -= (histogram[brightness] / foregroundNumber) * log2(histogram[brightness] / foregroundNumber);
+
+        for (int brightness = threshold + 1; brightness < 256; ++brightness)
+            if (histogram[brightness] / backgroundNumber != 0)
+                entropy[threshold] -= (histogram[brightness] / backgroundNumber) * log2(histogram[brightness] / backgroundNumber);
+
+        if (entropy[threshold] > maxEntropy)
+        {
+            kapurThreshold = threshold;
+            maxEntropy     = entropy[threshold];
+        }
+    }
+
+    return kapurThreshold;
+}
+
+byte_t PrefixSumKapurThresholdSearch(const double* histogram)
+{
+    assert(histogram != NULL);
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_THRESHOLD_SEARCH, 0, sizeof(double) * 256);
+
+    double cumulativeNumber[257]  = { 0.0 };
+    double cumulativeEntropy[257] = { 0.0 };
+    double reverseNumber[257]     = { 0.0 };
+    double reverseEntropy[257]    = { 0.0 };
+
+    double foregroundNumber       = 0.0;
+    double backgroundNumber       = 0.0;
+    double entropy                = 0.0;
+
+    byte_t kapurThreshold         = 0;
+    double maxEntropy             = DBL_MIN;
+
+    // With n pixels in a class, -sum((h / n) * log2(h / n)) == (n * log2(n) - sum(h * log2(h))) / n. The h * log2(h)
+    // terms are accumulated from both ends so that a class made of a single bin yields exactly zero entropy.
+    for (int brightness = 0; brightness < 256; ++brightness)
+    {
+        cumulativeNumber[brightness + 1]  = cumulativeNumber[brightness] + histogram[brightness];
+        cumulativeEntropy[brightness + 1] = cumulativeEntropy[brightness] +
+                                            ((histogram[brightness] != 0) ? (histogram[brightness] * log2(histogram[brightness])) : (0.0));
+    }
+
+    for (int brightness = 255; brightness >= 0; --brightness)
+    {
+        reverseNumber[brightness]  = reverseNumber[brightness + 1] + histogram[brightness];
+        reverseEntropy[brightness] = reverseEntropy[brightness + 1] +
+                                     ((histogram[brightness] != 0) ? (histogram[brightness] * log2(histogram[brightness])) : (0.0));
+    }
+
+    for (int threshold = 0; threshold < 256; ++threshold)
+    {
+        foregroundNumber = cumulativeNumber[threshold + 1];
+        backgroundNumber = reverseNumber[threshold + 1];
+
+        // An empty class with bins left to visit makes the exhaustive search divide 0 by 0, and the resulting NaN
+        // never wins the comparison. Only the background above 255 is legitimately empty.
+        if (foregroundNumber == 0 || (backgroundNumber == 0 && threshold < 255))
+            continue;
+
+        entropy = (foregroundNumber * log2(foregroundNumber) - cumulativeEntropy[threshold + 1]) / foregroundNumber;
+
+        if (backgroundNumber != 0)
+            entropy += (backgroundNumber * log2(backgroundNumber) - reverseEntropy[threshold + 1]) / backgroundNumber;
+
+        if (entropy > maxEntropy)
+        {
+            kapurThreshold = threshold;
+            maxEntropy     = entropy;
+        }
+    }
+
+    return kapurThreshold;
+}
+
+byte_t KapurThresholdSelection(const ImageView& inputImage, const ImageView& outputImage, ThresholdSearchMode searchMode, size_t sampleStride)
+{
+    assert(inputImage.pointer  != NULL);
+    assert(outputImage.pointer != NULL);
+    assert(IsSameImageSize(inputImage, outputImage));
+
+    uint32_t pixelHistogram[256] = { 0 };
+    double   histogram[256]      = { 0.0 };
+    byte_t   kapurThreshold      = 0;
+
+    ComputeSampledHistogram(inputImage, sampleStride, pixelHistogram);
+
+    for (int brightness = 0; brightness < 256; ++brightness)
+        histogram[brightness] = pixelHistogram[brightness];
+
+    kapurThreshold = (searchMode == THRESHOLD_SEARCH_MODE_PREFIX_SUM) ?
+                     (PrefixSumKapurThresholdSearch(histogram)) : (ExhaustiveKapurThresholdSearch(histogram));
+
+    BinarizeImage(inputImage, outputImage, kapurThreshold);
+
+    return kapurThreshold;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
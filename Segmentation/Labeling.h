@@ -0,0 +1,321 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef SEGMENTATION_LABELING_H
+#define SEGMENTATION_LABELING_H
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+#include "Segmentation/Image.h"
+#include "Segmentation/ThreadPool.h"
+
+// +------------------------------------------< TYPE DEFINITION >-------------------------------------------+
+
+enum LabelingMode
+{
+    LABELING_MODE_ITERATIVE_2PASS,
+    LABELING_MODE_UNION_FIND,
+    LABELING_MODE_PARALLEL_UNION_FIND,
+    LABELING_MODE_RUN_LENGTH,
+    LABELING_MODE_COMPACT_UNION_FIND
+};
+
+// Neighbourhood linking equal foreground pixels. CONNECTIVITY_8 is the one of every labeling mode, including the
+// links the pixel engines lack along the frame border.
+enum Connectivity
+{
+    CONNECTIVITY_4,
+    CONNECTIVITY_8
+};
+
+// Numbering of the components after labeling. Both orders number from 0, so the first component shares its
+// value with the background.
+enum LabelOrder
+{
+    LABEL_ORDER_RASTER,
+    LABEL_ORDER_AREA
+};
+
+// Horizontal run of equal foreground pixels in columns [beginColumn, endColumn) of 'row'.
+struct LabelRun
+{
+    uint32_t row;
+    uint32_t beginColumn;
+    uint32_t endColumn;
+    uint32_t label;
+    byte_t   value;
+};
+
+// Scratch buffers of the labeling engines, kept across calls so that frames of a size already seen make no heap
+// allocation. The run-length buffers are reserved for the most runs a binary mask of that size holds. Create one
+// per thread and pass it to every call. 'allocationNumber' counts the times a buffer had to grow.
+struct LabelingWorkspace
+{
+    std::vector<uint32_t>    label;
+    std::vector<uint32_t>    prevLabel;
+    std::vector<uint32_t>    equivalence;
+    std::vector<uint32_t>    sortedLabel;
+    std::vector<uint32_t>    renumberedLabel;
+    std::vector<uint32_t>    labelHistogram;
+    std::vector<uint32_t>    extractedLabel;
+    std::vector<uint32_t>    extractedAreaSize;
+    std::vector<uint32_t>    candidateLabel;
+    std::vector<uint32_t>    componentLabel;
+    std::vector<uint32_t>    stripEndLabel;
+    std::vector<size_t>      stripBeginRow;
+    std::vector<size_t>      rowRunIndex;
+    std::vector<LabelRun>    run;
+    std::vector<ImageRegion> region;
+    std::vector<byte_t>      keepTable;
+    std::vector<uint16_t>    compactLabel;
+    std::vector<uint16_t>    compactEquivalence;
+    size_t                   allocationNumber;
+
+    LabelingWorkspace(void) : allocationNumber(0) {}
+};
+
+struct LabelingReport
+{
+    uint32_t passNumber;
+    double   elapsedMilliseconds;
+};
+
+// Connected component finalized by a labeling stream. The bounding box is inclusive.
+struct StreamComponent
+{
+    uint64_t area;
+    size_t   left;
+    size_t   top;
+    size_t   right;
+    size_t   bottom;
+    byte_t   value;
+};
+
+typedef std::function<bool(byte_t* row)>                 RowReader;
+typedef std::function<void(const StreamComponent& info)> ComponentSink;
+
+// Run encoder of LabelRunPipeline, called through a plain function pointer so that handing over a lambda never
+// allocates.
+typedef void (*LabelRunEncoder)(const void* encode, std::vector<LabelRun>& run, std::vector<size_t>& rowRunIndex);
+
+struct ComponentStatistics;
+
+// State of a frame labeled row by row. It holds the runs of the previous row and one slot per live component,
+// so its size is O(width + live components) whatever the frame height. Prime it with InitLabelingStream.
+struct LabelingStream
+{
+    size_t                       width;
+    size_t                       row;
+    std::vector<LabelRun>        prevRun;
+    std::vector<LabelRun>        currentRun;
+    std::vector<StreamComponent> component;
+    std::vector<uint32_t>        equivalence;
+    std::vector<size_t>          lastRow;
+    std::vector<uint32_t>        liveSlot;
+    std::vector<uint32_t>        nextLiveSlot;
+    std::vector<uint32_t>        freeSlot;
+};
+
+// +-----------------------------------------< LABELING WORKSPACE >-----------------------------------------+
+
+// Resizes 'buffer' to 'size' elements, counting the growth of its capacity in 'workspace'. Contents are left
+// as they were, callers clear what they need.
+// 'capacity' reserves room for larger sizes later frames may ask for.
+template <typename T>
+inline T* AcquireWorkspaceBuffer(LabelingWorkspace* workspace, std::vector<T>& buffer, size_t size, size_t capacity = 0)
+{
+    if (std::max(size, capacity) > buffer.capacity())
+    {
+        ++workspace->allocationNumber;
+        buffer.reserve(std::max(size, capacity));
+    }
+
+    buffer.resize(size);
+
+    return buffer.data();
+}
+
+// Bytes held by the buffers of 'workspace'.
+size_t LabelingWorkspaceCapacity(const LabelingWorkspace& workspace);
+
+// +----------------------------------------< UNION-FIND LABELING >-----------------------------------------+
+
+uint32_t  FindRootLabel(uint32_t* equivalence, uint32_t label);
+uint32_t  UnionLabel(uint32_t* equivalence, uint32_t label1, uint32_t label2);
+uint32_t  UnionFindLabelPass(const ImageView& image, uint32_t* label, uint32_t* equivalence);
+uint32_t* UnionFindResolvePass(const ImageView& image, uint32_t* label, uint32_t* equivalence, uint32_t labelNumber);
+
+// Labels rows [beginRow, endRow) with provisional labels counting up from 'firstLabel' and returns the next
+// unused label. Links to the row above 'beginRow' are added afterwards by UnionFindMergeRow.
+uint32_t  UnionFindLabelStrip(const ImageView& image, uint32_t* label, uint32_t* equivalence, size_t beginRow, size_t endRow, uint32_t firstLabel);
+void      UnionFindMergeRow(const ImageView& image, uint32_t* label, uint32_t* equivalence, size_t row);
+
+// Labels and resolves the whole frame with the kernel of 'connectivity' (see LabelingKernel.h) and returns the
+// label bound. The 16-bit version returns 0 when the frame needs more than 65535 provisional labels.
+uint32_t  UnionFindLabeling(const ImageView& image, uint32_t* label, uint32_t* equivalence, Connectivity connectivity = CONNECTIVITY_8);
+uint32_t  UnionFindLabeling(const ImageView& image, uint16_t* label, uint16_t* equivalence, Connectivity connectivity = CONNECTIVITY_8);
+
+// +-----------------------------------------< PARALLEL LABELING >------------------------------------------+
+
+// Labels horizontal strips concurrently on 'threadPool', merges the equivalences across the strip borders and
+// resolves the label plane in parallel. Resolved labels are the smallest provisional label of each component;
+// their values differ from the serial engine, their raster order doesn't. 'equivalence' needs
+// 'width * height + 1' entries. Returns the label bound, one past the largest provisional label of any strip.
+uint32_t  ParallelUnionFindLabeling(const ImageView& image, uint32_t* label, uint32_t* equivalence, ThreadPool& threadPool,
+                                    LabelingWorkspace* workspace = NULL);
+
+// +----------------------------------------< RUN-LENGTH LABELING >-----------------------------------------+
+
+// True when a 'width * height' frame suits the run-length engine, whose neighbour rules need a first and a last
+// row and two border columns. The run pipelines hand smaller frames to the union-find path of Efficient2Pass on a
+// local 0/255 copy, which costs nothing for masks of a few rows or columns.
+inline bool IsLabelRunFrame(size_t width, size_t height)
+{
+    return width >= 3 && height >= 2;
+}
+
+// End of the run starting at 'beginColumn' of row 'iy' whose equal pixels reach 'endColumn', cut where the pixel
+// engines have no horizontal link: between the first two pixels of the first row and between the last two pixels
+// of the last row. Binary run encoders end every run with it to match EncodeLabelRun.
+inline size_t CutLabelRunEnd(size_t beginColumn, size_t endColumn, size_t iy, size_t width, size_t height)
+{
+    if (iy == 0 && beginColumn == 0)
+        return 1;
+
+    if (iy + 1 == height && endColumn == width && beginColumn + 1 < width)
+        return width - 1;
+
+    return endColumn;
+}
+
+// Encodes every row of 'image' as runs of equal nonzero pixels. 'rowRunIndex[iy]' is the first run of row 'iy'
+// and 'rowRunIndex[height]' the run count. Runs split where the pixel engines have no horizontal link.
+void     EncodeLabelRun(const ImageView& image, std::vector<LabelRun>& run, std::vector<size_t>& rowRunIndex);
+
+// EncodeLabelRun of the mask BinarizeImage makes at 'threshold', read off the grayscale frame: runs of pixels at
+// or above 'threshold' with value 255. Needs 'width >= 3' and 'height >= 2'.
+void     EncodeThresholdRun(const ImageView& image, byte_t threshold, std::vector<LabelRun>& run, std::vector<size_t>& rowRunIndex);
+
+// EncodeThresholdRun with every pixel outside 'region' taken as background, so only the regions are read.
+// Regions must lie inside the frame, be sorted by 'left' and keep a gap of at least one pixel between each other,
+// like the ones NormalizeImageRegion returns. Run coordinates stay those of the frame.
+void     EncodeThresholdRegionRun(const ImageView& image, byte_t threshold, const ImageRegion* region, size_t regionNumber,
+                                  std::vector<LabelRun>& run, std::vector<size_t>& rowRunIndex);
+
+// Merges overlapping runs of adjacent rows with the pixel engines' 8-connectivity, stores the component of every
+// run in 'label' (0-based, raster order of the first pixel) and its pixel count in 'componentArea'. Returns the
+// component count. Needs 'width >= 3' and 'height >= 2'.
+uint32_t RunLengthLabeling(const ImageView& image, std::vector<LabelRun>& run, const std::vector<size_t>& rowRunIndex,
+                           std::vector<uint32_t>& componentArea, LabelingWorkspace* workspace = NULL);
+
+// The labeling only needs the frame size, so runs encoded from other mask formats (see BitMask.h) use this one.
+uint32_t RunLengthLabeling(size_t width, size_t height, std::vector<LabelRun>& run, const std::vector<size_t>& rowRunIndex,
+                           std::vector<uint32_t>& componentArea, LabelingWorkspace* workspace = NULL);
+
+// Selection half of WriteLargeAreaRun: picks the 'areaExtractNumber' largest components of the areas
+// RunLengthLabeling left in 'workspace->labelHistogram' into 'workspace->extractedLabel' and returns their keep
+// table, 255 for the kept components, 'keepTable[0]' being the value of the background.
+byte_t*  SelectLargeAreaRun(uint32_t componentNumber, uint32_t areaExtractNumber, LabelingWorkspace* workspace);
+
+// Second half of RunLengthEfficient2Pass on the runs and areas RunLengthLabeling left in 'workspace' ('run' and
+// 'labelHistogram'): selects the 'areaExtractNumber' largest components into 'workspace->extractedLabel' and
+// writes them to 'outputImage' as 255. The runs may come from any frame of the size of 'outputImage'.
+byte_t*  WriteLargeAreaRun(const ImageView& outputImage, uint32_t componentNumber, uint32_t areaExtractNumber, LabelingWorkspace* workspace);
+
+// Labeling half shared by every run pipeline. It reserves the run buffers of 'workspace' for the frame, has
+// 'encode(run, rowRunIndex)' fill 'workspace->run' and 'workspace->rowRunIndex', labels the runs into
+// 'workspace->labelHistogram' with RunLengthLabeling and counts the buffer growth. 'pixelNumber' and 'byteNumber'
+// are what the encoder reads. With 'statistics', the component table of 'intensityImage' is measured before the
+// caller writes its output, which keeps the intensities valid in place. Returns the component count.
+uint32_t RunLabelRunPipeline(LabelingWorkspace* workspace, size_t width, size_t height, size_t pixelNumber, size_t byteNumber,
+                             const ImageView* intensityImage, ComponentStatistics* statistics, LabelRunEncoder encoder, const void* encode);
+
+template <typename Encode>
+inline void InvokeLabelRunEncoder(const void* encode, std::vector<LabelRun>& run, std::vector<size_t>& rowRunIndex)
+{
+    (*static_cast<const Encode*>(encode))(run, rowRunIndex);
+}
+
+template <typename Encode>
+inline uint32_t LabelRunPipeline(LabelingWorkspace* workspace, size_t width, size_t height, size_t pixelNumber, size_t byteNumber,
+                                 const ImageView* intensityImage, ComponentStatistics* statistics, const Encode& encode)
+{
+    return RunLabelRunPipeline(workspace, width, height, pixelNumber, byteNumber, intensityImage, statistics, &InvokeLabelRunEncoder<Encode>, &encode);
+}
+
+// Copies the 'areaExtractNumber' components the last run pipeline on 'workspace' extracted to
+// 'extractedComponent', when given.
+void     CopyExtractedComponent(const LabelingWorkspace& workspace, uint32_t areaExtractNumber, uint32_t* extractedComponent);
+
+// Efficient2Pass on runs instead of label planes. Time scales with the run count, which makes it the faster path
+// for sparse masks. The output is identical to the other modes.
+byte_t*  RunLengthEfficient2Pass(const ImageView& inputImage, const ImageView& outputImage, uint32_t areaExtractNumber,
+                                 LabelingWorkspace* workspace = NULL);
+
+// +-----------------------------------------< STREAMING LABELING >-----------------------------------------+
+
+// Streaming component analysis with plain 8-connectivity between equal nonzero pixels. Unlike the frame
+// engines, the first and last rows and columns get no special treatment since the height isn't known upfront.
+// Every component is handed to 'componentSink' as soon as a row no longer touches it.
+void   InitLabelingStream(LabelingStream* stream, size_t width);
+void   PushLabelingStreamRow(LabelingStream* stream, const byte_t* row, const ComponentSink& componentSink);
+void   FinishLabelingStream(LabelingStream* stream, const ComponentSink& componentSink);
+
+// Labels rows of 'width' pixels until 'rowReader' returns false or 'file' runs out of whole rows. Returns the
+// row count.
+size_t StreamComponentLabeling(const RowReader& rowReader, size_t width, const ComponentSink& componentSink);
+size_t StreamComponentLabeling(FILE* file, size_t width, const ComponentSink& componentSink);
+
+// +------------------------------------------< EFFICIENT 2-PASS >------------------------------------------+
+
+// Label planes are dense 'width * height' arrays, independent of the stride of the image they describe.
+uint32_t* TopDownPass(const ImageView& image, uint32_t* label);
+uint32_t* BottomUpPass(const ImageView& image, uint32_t* label);
+
+// Compacts the labels of a plane whose values are below 'labelNumber' to [0, count) and returns the count, at
+// least 1. The sorting renumbering sorts every foreground label (O(n * log(n))) and numbers them by value. The
+// default one remaps through a table of 'labelNumber' entries in one pass (O(n + labelNumber)), numbering by
+// first appearance in raster order, which is the value order for the planes the engines produce. The area order
+// adds a second pass and numbers from the largest component, ties in raster order.
+uint32_t  SortingLabelRenumbering(uint32_t* label, size_t labelSize, uint32_t labelNumber, LabelingWorkspace* workspace = NULL);
+uint32_t  LabelRenumbering(uint32_t* label, size_t labelSize, uint32_t labelNumber, LabelOrder labelOrder = LABEL_ORDER_RASTER,
+                           LabelingWorkspace* workspace = NULL);
+uint32_t* ExtractLargeAreaLabel(uint32_t* inputLabel, size_t labelSize, uint32_t labelNumber, uint32_t* outputLabel, uint32_t areaExtractNumber,
+                                LabelingWorkspace* workspace = NULL);
+
+// Selection step of ExtractLargeAreaLabel on a precomputed area per label. 'outputLabel' must be zeroed.
+// The exhaustive selection rescans every label for every slot (O(K * L)), the default one keeps the K largest
+// areas in a bounded heap during a single scan (O(L * log(K))). Both fill the same slots.
+uint32_t* ExhaustiveSelectLargeAreaLabel(const uint32_t* labelHistogram, uint32_t labelNumber, uint32_t* outputLabel, uint32_t areaExtractNumber,
+                                         LabelingWorkspace* workspace = NULL);
+uint32_t* SelectLargeAreaLabel(const uint32_t* labelHistogram, uint32_t labelNumber, uint32_t* outputLabel, uint32_t areaExtractNumber,
+                               LabelingWorkspace* workspace = NULL);
+
+// Sets 'keepTable[label]' to 255 for the extracted labels and to 0 for the other 'labelNumber' labels, so that
+// the output mask is a single lookup per pixel.
+byte_t*   MakeLabelKeepTable(const uint32_t* extractedLabel, uint32_t areaExtractNumber, uint32_t labelNumber, byte_t* keepTable);
+
+// Labels 'image' into the dense plane 'label' with one of the label plane engines (the run-length and compact
+// modes use union-find) and returns the bound of the label values, which sizes the tables indexed by label.
+// Every component carries one nonzero label, assigned in the raster order of its first pixel.
+uint32_t LabelImagePlane(const ImageView& image, uint32_t* label, LabelingMode labelingMode, uint32_t* passNumber, ThreadPool* threadPool = NULL,
+                         LabelingWorkspace* workspace = NULL);
+
+// Labels the 8-connected foreground of 'inputImage' and writes the 'areaExtractNumber' largest components to
+// 'outputImage' as 255. Returns 'outputImage.pointer'.
+// 'threadPool' is only used by LABELING_MODE_PARALLEL_UNION_FIND and defaults to DefaultThreadPool().
+// LABELING_MODE_COMPACT_UNION_FIND labels into 16-bit planes and tables, a quarter of the union-find memory, and
+// falls back to LABELING_MODE_UNION_FIND when a frame needs more than 65535 provisional labels.
+// Without 'workspace', every call allocates its scratch buffers anew.
+byte_t* Efficient2Pass(const ImageView& inputImage, const ImageView& outputImage, uint32_t areaExtractNumber = 1,
+                       LabelingMode labelingMode = LABELING_MODE_UNION_FIND, LabelingReport* labelingReport = NULL,
+                       ThreadPool* threadPool = NULL, LabelingWorkspace* workspace = NULL);
+
+#endif
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
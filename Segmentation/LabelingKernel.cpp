@@ -0,0 +1,34 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cassert>
+#include <cinttypes>
+
+#include "Segmentation/Instrumentation.h"
+#include "Segmentation/Labeling.h"
+#include "Segmentation/LabelingKernel.h"
+
+// +------------------------------------------< LABELING KERNEL >-------------------------------------------+
+
+template <typename Label>
+static uint32_t DispatchUnionFindLabeling(const ImageView& image, Label* label, Label* equivalence, Connectivity connectivity)
+{
+    return (connectivity == CONNECTIVITY_4) ?
+           (UnionFindLabelKernel<CONNECTIVITY_4, Label>(image, label, equivalence)) :
+           (UnionFindLabelKernel<CONNECTIVITY_8, Label>(image, label, equivalence));
+}
+
+uint32_t UnionFindLabeling(const ImageView& image, uint32_t* label, uint32_t* equivalence, Connectivity connectivity)
+{
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_UNION_FIND, image.width * image.height, image.width * image.height * (1 + 2 * sizeof(uint32_t)));
+
+    return DispatchUnionFindLabeling(image, label, equivalence, connectivity);
+}
+
+uint32_t UnionFindLabeling(const ImageView& image, uint16_t* label, uint16_t* equivalence, Connectivity connectivity)
+{
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_UNION_FIND, image.width * image.height, image.width * image.height * (1 + 2 * sizeof(uint16_t)));
+
+    return DispatchUnionFindLabeling(image, label, equivalence, connectivity);
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,208 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef SEGMENTATION_LABELING_KERNEL_H
+#define SEGMENTATION_LABELING_KERNEL_H
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <limits>
+
+#include "Segmentation/Image.h"
+#include "Segmentation/Labeling.h"
+
+// +------------------------------------------< LABELING KERNEL >-------------------------------------------+
+
+// Union-find kernels specialized at compile time. 'Label' is the type of the label plane and the equivalence
+// table, 'CONNECTIVITY' the neighbourhood, so every instance runs its link rules without runtime switches.
+// UnionFindLabeling picks the instance for a call.
+
+template <typename Label>
+inline Label FindKernelRootLabel(Label* equivalence, Label label)
+{
+    Label root = label;
+    Label next = 0;
+
+    while (equivalence[root] != root)
+        root = equivalence[root];
+
+    while (equivalence[label] != root)
+    {
+        next               = equivalence[label];
+        equivalence[label] = root;
+        label              = next;
+    }
+
+    return root;
+}
+
+// Same rule as UnionLabel, the smaller root wins. Labels already known to be equal skip the root search.
+template <typename Label>
+inline Label MergeKernelLabel(Label* equivalence, Label minLabel, Label neighbourLabel)
+{
+    if (minLabel == 0 || minLabel == neighbourLabel)
+        return neighbourLabel;
+
+    Label root1 = FindKernelRootLabel(equivalence, minLabel);
+    Label root2 = FindKernelRootLabel(equivalence, neighbourLabel);
+
+    if (root1 < root2)
+    {
+        equivalence[root2] = root1;
+        return root1;
+    }
+
+    equivalence[root1] = root2;
+    return root2;
+}
+
+// Links the foreground pixel 'ix' of row 'iy' to its labeled neighbours and returns its provisional label, 0 if
+// it starts a new component. CONNECTIVITY_8 follows the pixel engines, including the links they lack along the
+// frame border; CONNECTIVITY_4 links equal pixels to the left and above.
+// 'INTERIOR' pixels sit below the first row, at least two columns off the left border and off the last column.
+// There every neighbour link exists, so the 8-connected kernel walks the decision tree of Wu et al.: a pixel
+// equal to the one above needs no other link, since its other equal neighbours are already merged with it.
+template <Connectivity CONNECTIVITY, bool INTERIOR, typename Label>
+inline Label LinkKernelPixel(const byte_t* row, const byte_t* prevRow, const Label* labelRow, const Label* prevLabelRow, Label* equivalence,
+                             size_t ix, size_t iy, size_t width, size_t height)
+{
+    const byte_t value    = row[ix];
+    Label        minLabel = 0;
+
+    if (CONNECTIVITY == CONNECTIVITY_4)
+    {
+        if ((INTERIOR || ix > 0) && value == row[ix - 1])
+            minLabel = labelRow[ix - 1];
+
+        if ((INTERIOR || prevRow != NULL) && value == prevRow[ix])
+            minLabel = MergeKernelLabel(equivalence, minLabel, prevLabelRow[ix]);
+
+        return minLabel;
+    }
+
+    if (INTERIOR)
+    {
+        if (value == prevRow[ix])
+            return prevLabelRow[ix];
+
+        if (value == prevRow[ix + 1])
+        {
+            if (value == prevRow[ix - 1])
+                return MergeKernelLabel(equivalence, prevLabelRow[ix - 1], prevLabelRow[ix + 1]);
+
+            if (value == row[ix - 1])
+                return MergeKernelLabel(equivalence, labelRow[ix - 1], prevLabelRow[ix + 1]);
+
+            return prevLabelRow[ix + 1];
+        }
+
+        if (value == prevRow[ix - 1])
+            return prevLabelRow[ix - 1];
+
+        return (value == row[ix - 1]) ? (labelRow[ix - 1]) : (0);
+    }
+
+    if (ix > 0 && ((iy + 1 < height && ix > 1) || (iy > 0 && ix + 1 < width)) && value == row[ix - 1])
+        minLabel = labelRow[ix - 1];
+
+    if (prevRow != NULL && ix > 0 && (ix > 1 || ix + 1 < width) && value == prevRow[ix - 1])
+        minLabel = MergeKernelLabel(equivalence, minLabel, prevLabelRow[ix - 1]);
+
+    if (prevRow != NULL && ix > 0 && ix + 1 < width && value == prevRow[ix])
+        minLabel = MergeKernelLabel(equivalence, minLabel, prevLabelRow[ix]);
+
+    if (prevRow != NULL && ix + 1 < width && (ix + 2 < width || ix > 0) && value == prevRow[ix + 1])
+        minLabel = MergeKernelLabel(equivalence, minLabel, prevLabelRow[ix + 1]);
+
+    return minLabel;
+}
+
+// Labels the foreground pixels of columns [beginColumn, endColumn) of row 'iy', counting new labels in
+// 'labelNumber'. Returns false when a new label doesn't fit 'Label'.
+template <Connectivity CONNECTIVITY, bool INTERIOR, typename Label>
+inline bool LabelKernelColumn(const ImageView& image, Label* label, Label* equivalence, size_t iy, size_t width, size_t height,
+                              size_t beginColumn, size_t endColumn, size_t& labelNumber)
+{
+    const byte_t* row          = ImageRow(image, iy);
+    const byte_t* prevRow      = (iy > 0) ? (ImageRow(image, iy - 1)) : (NULL);
+    Label*        labelRow     = label + iy * width;
+    const Label*  prevLabelRow = (iy > 0) ? (labelRow - width) : (NULL);
+    Label         minLabel     = 0;
+
+    for (size_t ix = beginColumn; ix < endColumn; ++ix)
+    {
+        if (row[ix] == 0)
+        {
+            labelRow[ix] = 0;
+            continue;
+        }
+
+        minLabel = LinkKernelPixel<CONNECTIVITY, INTERIOR>(row, prevRow, labelRow, prevLabelRow, equivalence, ix, iy, width, height);
+
+        if (minLabel == 0)
+        {
+            if (labelNumber > std::numeric_limits<Label>::max())
+                return false;
+
+            minLabel              = static_cast<Label>(labelNumber++);
+            equivalence[minLabel] = minLabel;
+        }
+
+        labelRow[ix] = minLabel;
+    }
+
+    return true;
+}
+
+// Labels the whole frame into the dense plane 'label' and resolves it, so that every component carries its
+// smallest provisional label. Returns the label bound, or 0 when the provisional labels overflow 'Label', in
+// which case 'label' holds no usable result. 'equivalence' needs one entry per provisional label plus one, at
+// most 'width * height + 1'.
+template <Connectivity CONNECTIVITY, typename Label>
+inline uint32_t UnionFindLabelKernel(const ImageView& image, Label* label, Label* equivalence)
+{
+    assert(image.pointer != NULL);
+    assert(label         != NULL);
+    assert(equivalence   != NULL);
+
+    const size_t width       = image.width;
+    const size_t height      = image.height;
+
+    size_t       labelNumber = 1;
+    bool         success     = true;
+
+    equivalence[0] = 0;
+
+    if (width == 0 || height == 0)
+        return 1;
+
+    // The first row and the outermost columns take the full neighbour rules, the interior columns of the other
+    // rows run without border tests.
+    const size_t interiorBegin = std::min<size_t>(width, 2);
+    const size_t interiorEnd   = std::max<size_t>(interiorBegin, width - 1);
+
+    success = LabelKernelColumn<CONNECTIVITY, false>(image, label, equivalence, 0, width, height, 0, width, labelNumber);
+
+    for (size_t iy = 1; success && iy < height; ++iy)
+        success = LabelKernelColumn<CONNECTIVITY, false>(image, label, equivalence, iy, width, height, 0, interiorBegin, labelNumber) &&
+                  LabelKernelColumn<CONNECTIVITY, true>(image, label, equivalence, iy, width, height, interiorBegin, interiorEnd, labelNumber) &&
+                  LabelKernelColumn<CONNECTIVITY, false>(image, label, equivalence, iy, width, height, interiorEnd, width, labelNumber);
+
+    if (success == false)
+        return 0;
+
+    // Roots are always smaller than their children, so a single ascending sweep flattens the whole table.
+    for (size_t labelIndex = 1; labelIndex < labelNumber; ++labelIndex)
+        equivalence[labelIndex] = equivalence[equivalence[labelIndex]];
+
+    for (size_t index = 0; index < width * height; ++index)
+        label[index] = equivalence[label[index]];
+
+    return static_cast<uint32_t>(labelNumber);
+}
+
+#endif
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,236 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "Segmentation/Binarization.h"
+#include "Segmentation/Histogram.h"
+#include "Segmentation/Instrumentation.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +------------------------------------------< TYPE DEFINITION >-------------------------------------------+
+
+// Prefix sums of a 256-bin histogram from which the criterion of any class [beginBin, endBin] is read in O(1).
+struct ClassCriterion
+{
+    ThresholdMethod method;
+    double          cumulativeNumber[257];
+    double          cumulativeSum[257];
+    double          cumulativeEntropy[257];
+    double          mean;
+    bool            emptyClass;
+};
+
+// +----------------------------------< MULTI-LEVEL THRESHOLD SELECTION >-----------------------------------+
+
+static void InitClassCriterion(ClassCriterion* criterion, ThresholdMethod method, const double* histogram)
+{
+    criterion->method               = method;
+    criterion->cumulativeNumber[0]  = 0.0;
+    criterion->cumulativeSum[0]     = 0.0;
+    criterion->cumulativeEntropy[0] = 0.0;
+    criterion->emptyClass           = false;
+
+    for (int brightness = 0; brightness < 256; ++brightness)
+    {
+        criterion->cumulativeNumber[brightness + 1]  = criterion->cumulativeNumber[brightness] + histogram[brightness];
+        criterion->cumulativeSum[brightness + 1]     = criterion->cumulativeSum[brightness] + histogram[brightness] * brightness;
+        criterion->cumulativeEntropy[brightness + 1] = criterion->cumulativeEntropy[brightness] +
+                                                       ((histogram[brightness] != 0) ? (histogram[brightness] * log2(histogram[brightness])) : (0.0));
+    }
+
+    criterion->mean = (criterion->cumulativeNumber[256] != 0) ? (criterion->cumulativeSum[256] / criterion->cumulativeNumber[256]) : (0.0);
+}
+
+// Otsu: the class's share N * (mean - total mean)^2 of the between-class variance, 0 for an empty class.
+// Kapur: the class entropy (N * log2(N) - sum(h * log2(h))) / N. Like the single threshold search, only the
+// class that ends at 255 may be empty unless 'emptyClass' allows it everywhere.
+static double EvaluateClassCriterion(const ClassCriterion& criterion, int beginBin, int endBin)
+{
+    double number = criterion.cumulativeNumber[endBin + 1] - criterion.cumulativeNumber[beginBin];
+    double sum    = criterion.cumulativeSum[endBin + 1] - criterion.cumulativeSum[beginBin];
+
+    if (criterion.method == THRESHOLD_METHOD_OTSU)
+        return (number != 0) ? ((sum - number * criterion.mean) * (sum - number * criterion.mean) / number) : (0.0);
+
+    if (number == 0)
+        return (criterion.emptyClass || endBin == 255) ? (0.0) : (-std::numeric_limits<double>::infinity());
+
+    return (number * log2(number) - (criterion.cumulativeEntropy[endBin + 1] - criterion.cumulativeEntropy[beginBin])) / number;
+}
+
+// Criterion of every class [beginBin, endBin] at 'classCriterion[beginBin * 256 + endBin]', so the searches
+// evaluate each class, with its log2 for Kapur, once instead of once per level or tuple.
+static void ComputeClassCriterionTable(const ClassCriterion& criterion, std::vector<double>& classCriterion)
+{
+    classCriterion.assign(256 * 256, 0.0);
+
+    for (int beginBin = 0; beginBin < 256; ++beginBin)
+        for (int endBin = beginBin; endBin < 256; ++endBin)
+            classCriterion[beginBin * 256 + endBin] = EvaluateClassCriterion(criterion, beginBin, endBin);
+}
+
+// Best split of bins [beginBin, 255] into 'classNumber' classes, by dynamic programming over suffixes:
+// score[c][b] is the best criterion sum of 'c' classes covering [b, 255] and 'classEnd[c][b]' the last bin of the
+// first of them. Every entry takes O(256) reads of the class table, O(k * 256^2) overall, and the last level only
+// needs b = 0. Scores are summed from the last class backwards and ties keep the smallest end bin, so the
+// thresholds are the lexicographically first of the best.
+static double SearchMultiLevelThreshold(const ClassCriterion& criterion, uint32_t thresholdNumber, byte_t* threshold)
+{
+    const uint32_t classNumber = thresholdNumber + 1;
+
+    std::vector<double> classCriterion;
+    double              score[MAX_MULTI_LEVEL_THRESHOLD_NUMBER + 2][257];
+    int                 classEnd[MAX_MULTI_LEVEL_THRESHOLD_NUMBER + 2][257];
+
+    ComputeClassCriterionTable(criterion, classCriterion);
+
+    for (int beginBin = 0; beginBin < 256; ++beginBin)
+    {
+        score[1][beginBin]    = classCriterion[beginBin * 256 + 255];
+        classEnd[1][beginBin] = 255;
+    }
+
+    for (uint32_t classIndex = 2; classIndex <= classNumber; ++classIndex)
+    {
+        const int lastBeginBin = (classIndex == classNumber) ? (0) : (256 - static_cast<int>(classIndex));
+
+        // The remaining 'classIndex - 1' classes need at least one bin each.
+        for (int beginBin = 0; beginBin <= lastBeginBin; ++beginBin)
+        {
+            const double* beginCriterion = &classCriterion[beginBin * 256];
+            double        bestScore      = -std::numeric_limits<double>::infinity();
+            int           bestEnd        = beginBin;
+
+            for (int endBin = beginBin; endBin + static_cast<int>(classIndex) <= 256; ++endBin)
+            {
+                double candidate = beginCriterion[endBin] + score[classIndex - 1][endBin + 1];
+
+                if (candidate > bestScore)
+                {
+                    bestScore = candidate;
+                    bestEnd   = endBin;
+                }
+            }
+
+            score[classIndex][beginBin]    = bestScore;
+            classEnd[classIndex][beginBin] = bestEnd;
+        }
+    }
+
+    int beginBin = 0;
+
+    for (uint32_t thresholdIndex = 0; thresholdIndex < thresholdNumber; ++thresholdIndex)
+    {
+        threshold[thresholdIndex] = static_cast<byte_t>(classEnd[classNumber - thresholdIndex][beginBin]);
+        beginBin                  = threshold[thresholdIndex] + 1;
+    }
+
+    return score[classNumber][0];
+}
+
+// Tries every increasing threshold tuple against a table of all class criteria, O(256^k).
+static double ExhaustiveSearchMultiLevelThreshold(const ClassCriterion& criterion, uint32_t thresholdNumber, byte_t* threshold)
+{
+    std::vector<double> classCriterion;
+    int                 candidate[MAX_MULTI_LEVEL_THRESHOLD_NUMBER + 1];
+    double              bestScore = -std::numeric_limits<double>::infinity();
+    double              score     = 0.0;
+    int                 depth     = 0;
+
+    ComputeClassCriterionTable(criterion, classCriterion);
+
+    for (uint32_t thresholdIndex = 0; thresholdIndex < thresholdNumber; ++thresholdIndex)
+        threshold[thresholdIndex] = static_cast<byte_t>(thresholdIndex);
+
+    // Odometer over t[0] < t[1] < ... < t[k - 1] < 255 in lexicographic order.
+    candidate[0] = -1;
+
+    while (depth >= 0)
+    {
+        if (++candidate[depth] + static_cast<int>(thresholdNumber) - depth > 255)
+        {
+            --depth;
+            continue;
+        }
+
+        if (depth + 1 < static_cast<int>(thresholdNumber))
+        {
+            candidate[depth + 1] = candidate[depth];
+            ++depth;
+            continue;
+        }
+
+        score = classCriterion[(candidate[thresholdNumber - 1] + 1) * 256 + 255];
+
+        for (int classIndex = static_cast<int>(thresholdNumber) - 1; classIndex >= 0; --classIndex)
+            score = classCriterion[((classIndex > 0) ? (candidate[classIndex - 1] + 1) : (0)) * 256 + candidate[classIndex]] + score;
+
+        if (score > bestScore)
+        {
+            bestScore = score;
+
+            for (uint32_t thresholdIndex = 0; thresholdIndex < thresholdNumber; ++thresholdIndex)
+                threshold[thresholdIndex] = static_cast<byte_t>(candidate[thresholdIndex]);
+        }
+    }
+
+    return bestScore;
+}
+
+void MultiLevelThresholdSearch(ThresholdMethod method, const double* histogram, uint32_t thresholdNumber, byte_t* threshold,
+                               ThresholdSearchMode searchMode)
+{
+    assert(histogram != NULL);
+    assert(threshold != NULL);
+    assert(method == THRESHOLD_METHOD_OTSU || method == THRESHOLD_METHOD_KAPUR);
+    assert(thresholdNumber > 0 && thresholdNumber <= MAX_MULTI_LEVEL_THRESHOLD_NUMBER);
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_THRESHOLD_SEARCH, 0, sizeof(double) * 256);
+
+    ClassCriterion criterion;
+
+    InitClassCriterion(&criterion, method, histogram);
+
+    // Histograms with fewer occupied bins than classes leave no Kapur split without an empty class; those
+    // classes then count as zero entropy.
+    for (int attempt = 0; attempt < 2; ++attempt)
+    {
+        double score = (searchMode == THRESHOLD_SEARCH_MODE_PREFIX_SUM) ?
+                       (SearchMultiLevelThreshold(criterion, thresholdNumber, threshold)) :
+                       (ExhaustiveSearchMultiLevelThreshold(criterion, thresholdNumber, threshold));
+
+        if (score > -std::numeric_limits<double>::infinity())
+            break;
+
+        criterion.emptyClass = true;
+    }
+}
+
+void MultiLevelThresholdSelection(ThresholdMethod method, const ImageView& inputImage, const ImageView& outputImage, uint32_t thresholdNumber,
+                                  byte_t* threshold, ThresholdSearchMode searchMode)
+{
+    assert(inputImage.pointer  != NULL);
+    assert(outputImage.pointer != NULL);
+    assert(IsSameImageSize(inputImage, outputImage));
+
+    uint32_t pixelHistogram[256] = { 0 };
+    double   histogram[256]      = { 0.0 };
+
+    ComputeHistogram(inputImage, pixelHistogram);
+
+    for (int brightness = 0; brightness < 256; ++brightness)
+        histogram[brightness] = pixelHistogram[brightness];
+
+    MultiLevelThresholdSearch(method, histogram, thresholdNumber, threshold, searchMode);
+
+    // The search closes every class at its threshold, while the level image counts the thresholds at or below
+    // each pixel, which for a single threshold is exactly what OtsuThresholdSelection writes.
+    QuantizeImage(inputImage, outputImage, threshold, thresholdNumber);
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,139 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cassert>
+#include <cfloat>
+#include <cinttypes>
+#include <limits>
+
+#include "Segmentation/Binarization.h"
+#include "Segmentation/Histogram.h"
+#include "Segmentation/Instrumentation.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +--------------------------------------< OTSU THRESHOLD SELECTION >--------------------------------------+
+
+byte_t ExhaustiveOtsuThresholdSearch(const double* histogram)
+{
+    assert(histogram != NULL);
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_THRESHOLD_SEARCH, 0, sizeof(double) * 256);
+
+    double variance[256]    = { 0.0 };
+
+    double pixelNumber      = 0.0;
+    double foregroundMean   = 0.0;
+    double backgroundMean   = 0.0;
+    double foregroundNumber = 0.0;
+    double backgroundNumber = 0.0;
+
+    byte_t otsuThreshold    = 0;
+    double maxVariance      = DBL_MIN;
+
+    for (int brightness = 0; brightness < 256; ++brightness)
+        pixelNumber += histogram[brightness];
+
+    backgroundNumber = pixelNumber;
+
+    for (int threshold = 0; threshold < 256; ++threshold)
+    {
+        foregroundMean    = 0.0;
+        backgroundMean    = 0.0;
+        foregroundNumber += histogram[threshold];
+        backgroundNumber -= histogram[threshold];
+
+        for (int brightness = 0; brightness <= threshold; ++brightness)
+            foregroundMean += histogram[brightness] * brightness;
+        foregroundMean /= foregroundNumber;
+
+        for (int brightness = threshold + 1; brightness < 256; ++brightness)
+            backgroundMean += histogram[brightness] * brightness;
+        backgroundMean /= backgroundNumber;
+
+        variance[threshold] = (foregroundNumber / pixelNumber) * (backgroundNumber / pixelNumber) *
+                              (foregroundMean - backgroundMean) * (foregroundMean - backgroundMean);
+
+        if (variance[threshold] > maxVariance)
+        {
+            otsuThreshold = threshold;
+            maxVariance   = variance[threshold];
+        }
+    }
+
+    return otsuThreshold;
+}
+
+byte_t PrefixSumOtsuThresholdSearch(const double* histogram)
+{
+    assert(histogram != NULL);
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_THRESHOLD_SEARCH, 0, sizeof(double) * 256);
+
+    double cumulativeNumber[256] = { 0.0 };
+    double cumulativeSum[256]    = { 0.0 };
+
+    double pixelNumber           = 0.0;
+    double brightnessSum         = 0.0;
+    double foregroundMean        = 0.0;
+    double backgroundMean        = 0.0;
+    double foregroundNumber      = 0.0;
+    double backgroundNumber      = 0.0;
+    double variance              = 0.0;
+
+    byte_t otsuThreshold         = 0;
+    double maxVariance           = DBL_MIN;
+
+    for (int brightness = 0; brightness < 256; ++brightness)
+    {
+        pixelNumber   += histogram[brightness];
+        brightnessSum += histogram[brightness] * brightness;
+
+        cumulativeNumber[brightness] = pixelNumber;
+        cumulativeSum[brightness]    = brightnessSum;
+    }
+
+    // Counts and brightness sums are integers far below 2^53, so the differences below are exact and every
+    // variance is bit-identical to the one ExhaustiveOtsuThresholdSearch computes.
+    for (int threshold = 0; threshold < 256; ++threshold)
+    {
+        foregroundNumber = cumulativeNumber[threshold];
+        backgroundNumber = pixelNumber - foregroundNumber;
+        foregroundMean   = cumulativeSum[threshold] / foregroundNumber;
+        backgroundMean   = (brightnessSum - cumulativeSum[threshold]) / backgroundNumber;
+
+        variance = (foregroundNumber / pixelNumber) * (backgroundNumber / pixelNumber) *
+                   (foregroundMean - backgroundMean) * (foregroundMean - backgroundMean);
+
+        if (variance > maxVariance)
+        {
+            otsuThreshold = threshold;
+            maxVariance   = variance;
+        }
+    }
+
+    return otsuThreshold;
+}
+
+byte_t OtsuThresholdSelection(const ImageView& inputImage, const ImageView& outputImage, ThresholdSearchMode searchMode, size_t sampleStride)
+{
+    assert(inputImage.pointer  != NULL);
+    assert(outputImage.pointer != NULL);
+    assert(IsSameImageSize(inputImage, outputImage));
+
+    uint32_t pixelHistogram[256] = { 0 };
+    double   histogram[256]      = { 0.0 };
+    byte_t   otsuThreshold       = 0;
+
+    ComputeSampledHistogram(inputImage, sampleStride, pixelHistogram);
+
+    for (int brightness = 0; brightness < 256; ++brightness)
+        histogram[brightness] = pixelHistogram[brightness];
+
+    otsuThreshold = (searchMode == THRESHOLD_SEARCH_MODE_PREFIX_SUM) ?
+                    (PrefixSumOtsuThresholdSearch(histogram)) : (ExhaustiveOtsuThresholdSearch(histogram));
+
+    BinarizeImage(inputImage, outputImage, otsuThreshold);
+
+    return otsuThreshold;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
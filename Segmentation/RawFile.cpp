@@ -0,0 +1,325 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef _CRT_SECURE_NO_WARNINGS
+    #define _CRT_SECURE_NO_WARNINGS
+#endif
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "Segmentation/RawFile.h"
+
+// +----------------------------------------------< RAW FILE >----------------------------------------------+
+
+bool ReadRawImage(const char* fileName, const ImageView& image)
+{
+    assert(fileName      != NULL);
+    assert(image.pointer != NULL);
+
+    FILE* fileStream = fopen(fileName, "rb");
+    bool  success    = (fileStream != NULL);
+
+    for (size_t iy = 0; success && iy < image.height; ++iy)
+        success = (fread(ImageRow(image, iy), sizeof(byte_t), image.width, fileStream) == image.width);
+
+    if (fileStream != NULL)
+        fclose(fileStream);
+
+    return success;
+}
+
+bool WriteRawImage(const char* fileName, const ImageView& image)
+{
+    assert(fileName      != NULL);
+    assert(image.pointer != NULL);
+
+    FILE* fileStream = fopen(fileName, "w+b");
+    bool  success    = (fileStream != NULL);
+
+    for (size_t iy = 0; success && iy < image.height; ++iy)
+        success = (fwrite(ImageRow(image, iy), sizeof(byte_t), image.width, fileStream) == image.width);
+
+    if (fileStream != NULL)
+        success = (fclose(fileStream) == 0) && success;
+
+    return success;
+}
+
+// +------------------------------------------< MAPPED RAW FILE >-------------------------------------------+
+
+static void ResetMappedRawFile(MappedRawFile* file)
+{
+    file->pointer        = NULL;
+    file->size           = 0;
+    file->writable       = false;
+#if defined(_WIN32)
+    file->fileHandle     = INVALID_HANDLE_VALUE;
+    file->mappingHandle  = NULL;
+#else
+    file->fileDescriptor = -1;
+#endif
+}
+
+#if defined(_WIN32)
+
+static bool MapRawFile(MappedRawFile* file)
+{
+    DWORD protection = (file->writable) ? (PAGE_READWRITE) : (PAGE_READONLY);
+    DWORD access     = (file->writable) ? (FILE_MAP_WRITE) : (FILE_MAP_READ);
+
+    file->mappingHandle = CreateFileMappingA(file->fileHandle, NULL, protection, static_cast<DWORD>(static_cast<uint64_t>(file->size) >> 32),
+                                             static_cast<DWORD>(file->size), NULL);
+
+    if (file->mappingHandle != NULL)
+        file->pointer = static_cast<byte_t*>(MapViewOfFile(file->mappingHandle, access, 0, 0, file->size));
+
+    return file->pointer != NULL;
+}
+
+bool OpenMappedRawFile(MappedRawFile* file, const char* fileName)
+{
+    assert(file     != NULL);
+    assert(fileName != NULL);
+
+    LARGE_INTEGER fileSize;
+
+    ResetMappedRawFile(file);
+
+    file->fileHandle = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+    if (file->fileHandle != INVALID_HANDLE_VALUE && GetFileSizeEx(file->fileHandle, &fileSize) != 0 && fileSize.QuadPart > 0)
+    {
+        file->size = static_cast<size_t>(fileSize.QuadPart);
+
+        if (MapRawFile(file))
+            return true;
+    }
+
+    CloseMappedRawFile(file);
+
+    return false;
+}
+
+bool CreateMappedRawFile(MappedRawFile* file, const char* fileName, size_t size)
+{
+    assert(file     != NULL);
+    assert(fileName != NULL);
+    assert(size > 0);
+
+    ResetMappedRawFile(file);
+
+    file->fileHandle = CreateFileA(fileName, GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    file->size       = size;
+    file->writable   = true;
+
+    if (file->fileHandle != INVALID_HANDLE_VALUE && MapRawFile(file))
+        return true;
+
+    CloseMappedRawFile(file);
+
+    return false;
+}
+
+bool CloseMappedRawFile(MappedRawFile* file)
+{
+    assert(file != NULL);
+
+    bool success = true;
+
+    if (file->pointer != NULL)
+    {
+        if (file->writable)
+            success = (FlushViewOfFile(file->pointer, 0) != 0);
+
+        success = (UnmapViewOfFile(file->pointer) != 0) && success;
+    }
+
+    if (file->mappingHandle != NULL)
+        CloseHandle(file->mappingHandle);
+
+    if (file->fileHandle != INVALID_HANDLE_VALUE)
+        success = (CloseHandle(file->fileHandle) != 0) && success;
+
+    ResetMappedRawFile(file);
+
+    return success;
+}
+
+#else
+
+bool OpenMappedRawFile(MappedRawFile* file, const char* fileName)
+{
+    assert(file     != NULL);
+    assert(fileName != NULL);
+
+    struct stat fileStatus;
+    void*       pointer = MAP_FAILED;
+
+    ResetMappedRawFile(file);
+
+    file->fileDescriptor = open(fileName, O_RDONLY);
+
+    if (file->fileDescriptor >= 0 && fstat(file->fileDescriptor, &fileStatus) == 0 && fileStatus.st_size > 0)
+    {
+        file->size = static_cast<size_t>(fileStatus.st_size);
+        pointer    = mmap(NULL, file->size, PROT_READ, MAP_SHARED, file->fileDescriptor, 0);
+    }
+
+    if (pointer == MAP_FAILED)
+    {
+        CloseMappedRawFile(file);
+        return false;
+    }
+
+    file->pointer = static_cast<byte_t*>(pointer);
+
+    madvise(file->pointer, file->size, MADV_SEQUENTIAL);
+
+    return true;
+}
+
+bool CreateMappedRawFile(MappedRawFile* file, const char* fileName, size_t size)
+{
+    assert(file     != NULL);
+    assert(fileName != NULL);
+    assert(size > 0);
+
+    void* pointer = MAP_FAILED;
+    bool  success = false;
+
+    ResetMappedRawFile(file);
+
+    file->fileDescriptor = open(fileName, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    file->size           = size;
+    file->writable       = true;
+
+    // Reserving the blocks upfront turns a full disk into an error here rather than a SIGBUS on the first store
+    // to a page that has no room.
+    if (file->fileDescriptor >= 0)
+    {
+#if defined(__linux__)
+        success = (posix_fallocate(file->fileDescriptor, 0, static_cast<off_t>(size)) == 0);
+#else
+        success = (ftruncate(file->fileDescriptor, static_cast<off_t>(size)) == 0);
+#endif
+    }
+
+    if (success)
+        pointer = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, file->fileDescriptor, 0);
+
+    if (pointer == MAP_FAILED)
+    {
+        CloseMappedRawFile(file);
+        return false;
+    }
+
+    file->pointer = static_cast<byte_t*>(pointer);
+
+    madvise(file->pointer, file->size, MADV_SEQUENTIAL);
+
+    return true;
+}
+
+bool CloseMappedRawFile(MappedRawFile* file)
+{
+    assert(file != NULL);
+
+    bool success = true;
+
+    // munmap and close never report writeback errors, only a synchronous msync does.
+    if (file->pointer != NULL)
+    {
+        if (file->writable)
+            success = (msync(file->pointer, file->size, MS_SYNC) == 0);
+
+        success = (munmap(file->pointer, file->size) == 0) && success;
+    }
+
+    if (file->fileDescriptor >= 0)
+        success = (close(file->fileDescriptor) == 0) && success;
+
+    ResetMappedRawFile(file);
+
+    return success;
+}
+
+#endif
+
+bool MapRawImageRegion(const MappedRawFile& file, size_t fileWidth, size_t left, size_t top, size_t width, size_t height, ImageView* image)
+{
+    assert(file.pointer != NULL);
+    assert(image        != NULL);
+    assert(width > 0 && height > 0);
+
+    if (fileWidth == 0 || left + width > fileWidth || (top + height) > file.size / fileWidth)
+        return false;
+
+    *image = MakeImageView(file.pointer + top * fileWidth + left, width, height, fileWidth);
+
+    return true;
+}
+
+#if !defined(_WIN32)
+
+// madvise and msync take page-aligned ranges; widening the rows of 'image' to whole pages only reaches the
+// neighbours of the region.
+static void GetMappedPageRange(const MappedRawFile& file, const ImageView& image, void** begin, size_t* length)
+{
+    assert(image.pointer >= file.pointer && image.pointer < file.pointer + file.size);
+    (void)file;
+
+    uintptr_t pageMask   = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE)) - 1;
+    uintptr_t beginIndex = reinterpret_cast<uintptr_t>(image.pointer) & ~pageMask;
+    uintptr_t endIndex   = reinterpret_cast<uintptr_t>(ImageRow(image, image.height - 1) + image.width);
+
+    *begin  = reinterpret_cast<void*>(beginIndex);
+    *length = endIndex - beginIndex;
+}
+
+#endif
+
+void PrefetchMappedRawImage(const MappedRawFile& file, const ImageView& image)
+{
+#if defined(_WIN32)
+    (void)file;
+    (void)image;
+#else
+    void*  begin  = NULL;
+    size_t length = 0;
+
+    GetMappedPageRange(file, image, &begin, &length);
+    madvise(begin, length, MADV_WILLNEED);
+#endif
+}
+
+void ReleaseMappedRawImage(const MappedRawFile& file, const ImageView& image)
+{
+#if defined(_WIN32)
+    (void)file;
+    (void)image;
+#else
+    void*  begin  = NULL;
+    size_t length = 0;
+
+    GetMappedPageRange(file, image, &begin, &length);
+
+    if (file.writable)
+        msync(begin, length, MS_ASYNC);
+    else
+        madvise(begin, length, MADV_DONTNEED);
+#endif
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,53 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef SEGMENTATION_RAW_FILE_H
+#define SEGMENTATION_RAW_FILE_H
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include "Segmentation/Image.h"
+
+// +----------------------------------------------< RAW FILE >----------------------------------------------+
+
+// Headerless 8-bit frames as stored in 'Resource/'. Both functions return false when the file can't be opened
+// or holds fewer than 'width * height' bytes.
+bool ReadRawImage(const char* fileName, const ImageView& image);
+bool WriteRawImage(const char* fileName, const ImageView& image);
+
+// +------------------------------------------< MAPPED RAW FILE >-------------------------------------------+
+
+// RAW file mapped into memory, so that frames are processed in place with no stdio copy and pages are faulted
+// in as the work reaches them. Read mappings are read-only: a view of one can only be used as an input.
+struct MappedRawFile
+{
+    byte_t* pointer;
+    size_t  size;
+    bool    writable;
+#if defined(_WIN32)
+    void*   fileHandle;
+    void*   mappingHandle;
+#else
+    int     fileDescriptor;
+#endif
+};
+
+// Maps an existing file for reading with a sequential access hint, or creates (truncates) a 'size' byte file and
+// maps it for writing. Both return false when the file can't be opened or mapped, and leave 'file' closed.
+// CloseMappedRawFile returns false when written pages couldn't be flushed.
+bool OpenMappedRawFile(MappedRawFile* file, const char* fileName);
+bool CreateMappedRawFile(MappedRawFile* file, const char* fileName, size_t size);
+bool CloseMappedRawFile(MappedRawFile* file);
+
+// Sets 'image' to the 'width * height' region at ('left', 'top') of a file holding rows of 'fileWidth' pixels,
+// e.g. a tile of a stitched scan or one frame of a stack. Returns false when the region leaves the file.
+bool MapRawImageRegion(const MappedRawFile& file, size_t fileWidth, size_t left, size_t top, size_t width, size_t height, ImageView* image);
+
+// Paging hints over the rows spanned by a view of 'file': prefetch them before a region is processed, release
+// them once it is done so that huge files don't crowd the page cache. Writable pages are queued for writeback
+// instead of dropped.
+void PrefetchMappedRawImage(const MappedRawFile& file, const ImageView& image);
+void ReleaseMappedRawImage(const MappedRawFile& file, const ImageView& image);
+
+#endif
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
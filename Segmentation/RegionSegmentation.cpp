@@ -0,0 +1,362 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <vector>
+
+#include "Segmentation/FusedSegmentation.h"
+#include "Segmentation/Histogram.h"
+#include "Segmentation/Instrumentation.h"
+#include "Segmentation/RegionSegmentation.h"
+
+// +----------------------------------------< REGION SEGMENTATION >-----------------------------------------+
+
+// True when the two regions overlap or touch, diagonally included.
+static bool IsNearImageRegion(const ImageRegion& region1, const ImageRegion& region2)
+{
+    return region1.left <= region2.left + region2.width && region2.left <= region1.left + region1.width &&
+           region1.top <= region2.top + region2.height && region2.top <= region1.top + region1.height;
+}
+
+static ImageRegion BoundImageRegion(const ImageRegion& region1, const ImageRegion& region2)
+{
+    const size_t left   = std::min(region1.left, region2.left);
+    const size_t top    = std::min(region1.top, region2.top);
+    const size_t right  = std::max(region1.left + region1.width, region2.left + region2.width);
+    const size_t bottom = std::max(region1.top + region1.height, region2.top + region2.height);
+
+    return MakeImageRegion(left, top, right - left, bottom - top);
+}
+
+// Seed of InitIterativeThresholdSelection over several regions: the foreground mean of every pixel but the region
+// corners, with the same '(width - 2) * (height - 2)' normalization, against the mean of the corners.
+static byte_t InitRegionIterativeThreshold(const uint32_t* histogram, const std::vector<ImageRegion>& region, uint32_t cornerSum)
+{
+    double foregroundMean = 0.0;
+    double backgroundMean = cornerSum;
+    size_t seedNumber     = 0;
+
+    for (int brightness = 0; brightness < 256; ++brightness)
+        foregroundMean += static_cast<double>(histogram[brightness]) * brightness;
+
+    for (size_t regionIndex = 0; regionIndex < region.size(); ++regionIndex)
+        seedNumber += (region[regionIndex].width - 2) * (region[regionIndex].height - 2);
+
+    foregroundMean -= backgroundMean;
+
+    foregroundMean /= static_cast<double>(seedNumber);
+    backgroundMean /= 4.0 * region.size();
+
+    return static_cast<byte_t>((foregroundMean + backgroundMean) / 2.0 + 0.5);
+}
+
+size_t NormalizeImageRegion(const ImageRegion* region, size_t regionNumber, size_t width, size_t height, std::vector<ImageRegion>& normalizedRegion)
+{
+    assert(region != NULL || regionNumber == 0);
+    assert(width >= 3 && height >= 3);
+
+    bool merged = true;
+
+    normalizedRegion.clear();
+
+    for (size_t regionIndex = 0; regionIndex < regionNumber; ++regionIndex)
+    {
+        if (region[regionIndex].left >= width || region[regionIndex].top >= height || region[regionIndex].width == 0 || region[regionIndex].height == 0)
+            continue;
+
+        size_t left   = region[regionIndex].left;
+        size_t top    = region[regionIndex].top;
+        size_t right  = left + std::min(region[regionIndex].width, width - left);
+        size_t bottom = top + std::min(region[regionIndex].height, height - top);
+
+        // Grown to the 3x3 the iterative seed and the run-length neighbour rules need, toward the frame inside.
+        if (right - left < 3)
+        {
+            right = std::min(left + 3, width);
+            left  = right - 3;
+        }
+
+        if (bottom - top < 3)
+        {
+            bottom = std::min(top + 3, height);
+            top    = bottom - 3;
+        }
+
+        normalizedRegion.push_back(MakeImageRegion(left, top, right - left, bottom - top));
+    }
+
+    // A merged box may reach regions neither part did, so merge until no pair is left.
+    while (merged)
+    {
+        merged = false;
+
+        for (size_t regionIndex1 = 0; regionIndex1 < normalizedRegion.size() && merged == false; ++regionIndex1)
+            for (size_t regionIndex2 = regionIndex1 + 1; regionIndex2 < normalizedRegion.size() && merged == false; ++regionIndex2)
+                if (IsNearImageRegion(normalizedRegion[regionIndex1], normalizedRegion[regionIndex2]))
+                {
+                    normalizedRegion[regionIndex1] = BoundImageRegion(normalizedRegion[regionIndex1], normalizedRegion[regionIndex2]);
+                    normalizedRegion.erase(normalizedRegion.begin() + regionIndex2);
+
+                    merged = true;
+                }
+    }
+
+    std::sort(normalizedRegion.begin(), normalizedRegion.end(), [](const ImageRegion& region1, const ImageRegion& region2)
+    {
+        return region1.left < region2.left;
+    });
+
+    return normalizedRegion.size();
+}
+
+byte_t RegionSegmentation(ThresholdMethod thresholdMethod, const ImageView& inputImage, const ImageView& outputImage, const ImageRegion* region,
+                          size_t regionNumber, uint32_t areaExtractNumber, ComponentStatistics* statistics, uint32_t* extractedComponent,
+                          LabelingWorkspace* workspace)
+{
+    assert(inputImage.pointer  != NULL);
+    assert(outputImage.pointer != NULL);
+    assert(IsSameImageSize(inputImage, outputImage));
+    assert(inputImage.width >= 3 && inputImage.height >= 3);
+    assert(areaExtractNumber > 0);
+
+    LabelingWorkspace localWorkspace;
+
+    if (workspace == NULL)
+        workspace = &localWorkspace;
+
+    const size_t width  = inputImage.width;
+    const size_t height = inputImage.height;
+
+    std::vector<ImageRegion>& normalizedRegion  = workspace->region;
+    size_t                    regionCapacity    = normalizedRegion.capacity();
+    uint32_t                  histogram[256]    = { 0 };
+    uint32_t                  regionHistogram[256];
+    uint32_t                  cornerSum         = 0;
+    size_t                    regionPixelNumber = 0;
+    uint32_t                  componentNumber   = 0;
+    byte_t                    threshold         = 0;
+
+    if (NormalizeImageRegion(region, regionNumber, width, height, normalizedRegion) == 0)
+        return FusedSegmentation(thresholdMethod, inputImage, outputImage, areaExtractNumber, statistics, extractedComponent, 1, workspace);
+
+    for (size_t regionIndex = 0; regionIndex < normalizedRegion.size(); ++regionIndex)
+    {
+        ImageView regionView = CropImageView(inputImage, normalizedRegion[regionIndex]);
+
+        ComputeHistogram(regionView, regionHistogram);
+
+        for (int brightness = 0; brightness < 256; ++brightness)
+            histogram[brightness] += regionHistogram[brightness];
+
+        cornerSum         += SumImageCorner(regionView);
+        regionPixelNumber += regionView.width * regionView.height;
+    }
+
+    threshold = (thresholdMethod == THRESHOLD_METHOD_ITERATIVE) ?
+                (IterativeThresholdSearch(histogram, InitRegionIterativeThreshold(histogram, normalizedRegion, cornerSum))) :
+                (SelectThreshold(thresholdMethod, histogram, width, height, cornerSum));
+
+    auto encode = [&](std::vector<LabelRun>& run, std::vector<size_t>& rowRunIndex)
+    {
+        EncodeThresholdRegionRun(inputImage, threshold, normalizedRegion.data(), normalizedRegion.size(), run, rowRunIndex);
+    };
+
+    componentNumber = LabelRunPipeline(workspace, width, height, regionPixelNumber, regionPixelNumber, &inputImage, statistics, encode);
+
+    WriteLargeAreaRun(outputImage, componentNumber, areaExtractNumber, workspace);
+
+    SEGMENTATION_COUNT(INSTRUMENTATION_COUNTER_PASS, 1);
+
+    workspace->allocationNumber += (normalizedRegion.capacity() > regionCapacity) ? (1) : (0);
+
+    CopyExtractedComponent(*workspace, areaExtractNumber, extractedComponent);
+
+    return threshold;
+}
+
+// +------------------------------------------< REGION TRACKING >-------------------------------------------+
+
+// True when the bounding box of 'component' reaches an edge of the region holding it that isn't a frame border,
+// so the component may continue outside the region.
+static bool ReachRegionEdge(const ComponentStatistics& statistics, uint32_t component, const std::vector<ImageRegion>& region, size_t width,
+                            size_t height)
+{
+    for (size_t regionIndex = 0; regionIndex < region.size(); ++regionIndex)
+    {
+        const ImageRegion& current = region[regionIndex];
+        const size_t       right   = current.left + current.width;
+        const size_t       bottom  = current.top + current.height;
+
+        if (statistics.left[component] < current.left || statistics.left[component] >= right ||
+            statistics.top[component] < current.top || statistics.top[component] >= bottom)
+            continue;
+
+        return (statistics.left[component] == current.left && current.left > 0) ||
+               (statistics.top[component] == current.top && current.top > 0) ||
+               (statistics.right[component] + 1 == right && right < width) ||
+               (statistics.bottom[component] + 1 == bottom && bottom < height);
+    }
+
+    return true;
+}
+
+// Fills 'trackedComponent' with the 'areaExtractNumber' largest components but component 0, larger areas
+// first and smaller numbers first among equal areas. Unlike the extracted slots, which repeat tied labels, every
+// component appears once, so the tracked set holds every component the extraction may pick.
+static void SelectTrackedComponent(RegionTracker* tracker)
+{
+    const std::vector<uint32_t>& area             = tracker->statistics.area;
+    std::vector<uint32_t>&       trackedComponent = tracker->trackedComponent;
+
+    auto largerArea = [&area](uint32_t component1, uint32_t component2)
+    {
+        return (area[component1] != area[component2]) ? (area[component1] > area[component2]) : (component1 < component2);
+    };
+
+    trackedComponent.clear();
+
+    for (uint32_t component = 1; component < tracker->statistics.componentNumber; ++component)
+    {
+        if (trackedComponent.size() < tracker->areaExtractNumber)
+        {
+            trackedComponent.push_back(component);
+            std::push_heap(trackedComponent.begin(), trackedComponent.end(), largerArea);
+        }
+        else if (largerArea(component, trackedComponent.front()))
+        {
+            std::pop_heap(trackedComponent.begin(), trackedComponent.end(), largerArea);
+            trackedComponent.back() = component;
+            std::push_heap(trackedComponent.begin(), trackedComponent.end(), largerArea);
+        }
+    }
+
+    std::sort_heap(trackedComponent.begin(), trackedComponent.end(), largerArea);
+}
+
+static bool IsTrackingLost(const RegionTracker& tracker, const std::vector<ImageRegion>& region, size_t width, size_t height)
+{
+    if (tracker.trackedComponent.empty() || ReachRegionEdge(tracker.statistics, 0, region, width, height))
+        return true;
+
+    for (size_t trackedIndex = 0; trackedIndex < tracker.trackedComponent.size(); ++trackedIndex)
+        if (ReachRegionEdge(tracker.statistics, tracker.trackedComponent[trackedIndex], region, width, height))
+            return true;
+
+    return false;
+}
+
+static ImageRegion ComponentRegion(const ComponentStatistics& statistics, uint32_t component, size_t margin, size_t width, size_t height)
+{
+    const size_t left   = (statistics.left[component] > margin) ? (statistics.left[component] - margin) : (0);
+    const size_t top    = (statistics.top[component] > margin) ? (statistics.top[component] - margin) : (0);
+    const size_t right  = std::min(statistics.right[component] + 1 + margin, width);
+    const size_t bottom = std::min(statistics.bottom[component] + 1 + margin, height);
+
+    return MakeImageRegion(left, top, right - left, bottom - top);
+}
+
+// Regions of the next frame: the boxes of component 0 and of the tracked components grown by the margin, none
+// when nothing is tracked. 'box' is scratch storage.
+static void UpdateTrackedRegion(RegionTracker* tracker, size_t width, size_t height, std::vector<ImageRegion>& box)
+{
+    box.clear();
+
+    if (tracker->trackedComponent.empty() == false)
+    {
+        box.push_back(ComponentRegion(tracker->statistics, 0, tracker->margin, width, height));
+
+        for (size_t trackedIndex = 0; trackedIndex < tracker->trackedComponent.size(); ++trackedIndex)
+            box.push_back(ComponentRegion(tracker->statistics, tracker->trackedComponent[trackedIndex], tracker->margin, width, height));
+    }
+
+    NormalizeImageRegion(box.data(), box.size(), width, height, tracker->region);
+}
+
+void InitRegionTracker(RegionTracker* tracker, ThresholdMethod method, uint32_t areaExtractNumber, size_t margin, size_t refreshInterval)
+{
+    assert(tracker != NULL);
+    assert(areaExtractNumber > 0);
+
+    tracker->method            = method;
+    tracker->areaExtractNumber = areaExtractNumber;
+    tracker->margin            = margin;
+    tracker->refreshInterval   = refreshInterval;
+    tracker->frameWidth        = 0;
+    tracker->frameHeight       = 0;
+    tracker->threshold         = 0;
+    tracker->frameNumber       = 0;
+    tracker->fullFrameNumber   = 0;
+    tracker->lostNumber        = 0;
+    tracker->lastFullFrame     = 0;
+
+    tracker->region.clear();
+    tracker->trackedComponent.clear();
+    tracker->extractedComponent.assign(areaExtractNumber, 0);
+
+    ResetComponentStatistics(&tracker->statistics, 0);
+}
+
+byte_t TrackRegionSegmentation(RegionTracker* tracker, const ImageView& inputImage, const ImageView& outputImage, LabelingWorkspace* workspace)
+{
+    assert(tracker != NULL);
+    assert(inputImage.pointer != NULL && outputImage.pointer != NULL);
+    assert(inputImage.pointer != outputImage.pointer);
+    assert(IsSameImageSize(inputImage, outputImage));
+    assert(inputImage.width >= 3 && inputImage.height >= 3);
+
+    LabelingWorkspace localWorkspace;
+
+    if (workspace == NULL)
+        workspace = &localWorkspace;
+
+    const size_t width     = inputImage.width;
+    const size_t height    = inputImage.height;
+    bool         fullFrame = tracker->region.empty() || width != tracker->frameWidth || height != tracker->frameHeight ||
+                             (tracker->refreshInterval > 0 && tracker->frameNumber - tracker->lastFullFrame >= tracker->refreshInterval);
+
+    if (fullFrame == false)
+    {
+        tracker->threshold = RegionSegmentation(tracker->method, inputImage, outputImage, tracker->region.data(), tracker->region.size(),
+                                                tracker->areaExtractNumber, &tracker->statistics, tracker->extractedComponent.data(), workspace);
+
+        SelectTrackedComponent(tracker);
+
+        if (IsTrackingLost(*tracker, workspace->region, width, height))
+        {
+            fullFrame = true;
+
+            ++tracker->lostNumber;
+        }
+    }
+
+    if (fullFrame)
+    {
+        tracker->threshold = FusedSegmentation(tracker->method, inputImage, outputImage, tracker->areaExtractNumber, &tracker->statistics,
+                                               tracker->extractedComponent.data(), 1, workspace);
+
+        tracker->lastFullFrame = tracker->frameNumber;
+
+        ++tracker->fullFrameNumber;
+
+        SelectTrackedComponent(tracker);
+    }
+
+    tracker->frameWidth  = width;
+    tracker->frameHeight = height;
+
+    ++tracker->frameNumber;
+
+    UpdateTrackedRegion(tracker, width, height, workspace->region);
+
+    return tracker->threshold;
+}
+
+void ResetRegionTracker(RegionTracker* tracker)
+{
+    assert(tracker != NULL);
+
+    tracker->region.clear();
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,85 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef SEGMENTATION_REGION_SEGMENTATION_H
+#define SEGMENTATION_REGION_SEGMENTATION_H
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cinttypes>
+#include <vector>
+
+#include "Segmentation/ComponentStatistics.h"
+#include "Segmentation/Image.h"
+#include "Segmentation/Labeling.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +------------------------------------------< TYPE DEFINITION >-------------------------------------------+
+
+// State of a per-stream region tracker. Prime it with InitRegionTracker. 'region' holds the regions the next
+// frame is processed in, empty when it takes a full-frame pass. 'statistics', 'extractedComponent' and
+// 'trackedComponent' are those of the last frame, measured over its regions only when it was processed by
+// regions. 'frameNumber' counts the frames seen, 'fullFrameNumber' those that took a full-frame pass and
+// 'lostNumber' the region passes whose result was dropped for one.
+struct RegionTracker
+{
+    ThresholdMethod          method;
+    uint32_t                 areaExtractNumber;
+    size_t                   margin;
+    size_t                   refreshInterval;
+    size_t                   frameWidth;
+    size_t                   frameHeight;
+    std::vector<ImageRegion> region;
+    ComponentStatistics      statistics;
+    std::vector<uint32_t>    extractedComponent;
+    std::vector<uint32_t>    trackedComponent;
+    byte_t                   threshold;
+    size_t                   frameNumber;
+    size_t                   fullFrameNumber;
+    size_t                   lostNumber;
+    size_t                   lastFullFrame;
+};
+
+// +----------------------------------------< REGION SEGMENTATION >-----------------------------------------+
+
+// Turns caller rectangles into regions the region engine accepts: clipped to the 'width * height' frame (at
+// least 3x3), empty ones dropped, grown to at least 3x3, regions closer than one pixel merged into their
+// bounding box, and the result sorted by 'left'. Returns the region count of 'normalizedRegion'.
+size_t NormalizeImageRegion(const ImageRegion* region, size_t regionNumber, size_t width, size_t height, std::vector<ImageRegion>& normalizedRegion);
+
+// FusedSegmentation restricted to 'region'. The histogram, the threshold pass and the labeling only read the
+// normalized regions, every pixel outside them counting as background, so the cost follows the region area
+// instead of the frame area. The threshold is that of 'thresholdMethod' on the histogram of the regions, the
+// iterative seed taking the corners of every region; with one region it is the threshold of the selector on the
+// cropped frame. 'outputImage' receives, byte for byte, what Efficient2Pass writes for the mask binarized at
+// that threshold with the outside of the regions cleared, so it is fully written and may be 'inputImage'.
+// 'statistics' and 'extractedComponent' are those of FusedSegmentation over that mask. The frame must be at
+// least 3x3. Without a region left after normalization the whole frame is processed. Returns the threshold.
+byte_t RegionSegmentation(ThresholdMethod thresholdMethod, const ImageView& inputImage, const ImageView& outputImage, const ImageRegion* region,
+                          size_t regionNumber, uint32_t areaExtractNumber = 1, ComponentStatistics* statistics = NULL,
+                          uint32_t* extractedComponent = NULL, LabelingWorkspace* workspace = NULL);
+
+// +------------------------------------------< REGION TRACKING >-------------------------------------------+
+
+// Objects of a stream move little between frames. The tracker processes each frame only inside the bounding
+// boxes of the last frame's 'areaExtractNumber' largest components and component 0, grown by 'margin' pixels.
+// Component 0 stays tracked because it shares its value with the background and is never extracted: keeping it
+// inside the regions keeps the raster numbering, and so the extraction, that of the full frame. A frame takes a
+// full-frame FusedSegmentation instead when nothing is tracked, when its size changed, every 'refreshInterval'
+// frames (0 for never), and when tracking is lost: the regions hold no component but component 0, or a tracked
+// component reaches the edge of its region where it may continue outside. A lost frame is processed again in
+// full. Region frames take their threshold from the histogram of the regions, so they match FusedSegmentation
+// as long as it splits the pixels of the regions like the full-frame threshold and no component outside the
+// regions grows larger than the tracked ones. 'outputImage' must not be 'inputImage', which a lost frame reads
+// again.
+void InitRegionTracker(RegionTracker* tracker, ThresholdMethod method, uint32_t areaExtractNumber = 1, size_t margin = 32,
+                       size_t refreshInterval = 30);
+
+// Segments 'inputImage' into 'outputImage' like FusedSegmentation and returns the threshold.
+byte_t TrackRegionSegmentation(RegionTracker* tracker, const ImageView& inputImage, const ImageView& outputImage, LabelingWorkspace* workspace = NULL);
+
+// Drops the tracked regions after a scene cut, so the next frame takes a full-frame pass.
+void ResetRegionTracker(RegionTracker* tracker);
+
+#endif
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,397 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <cstring>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #include <immintrin.h>
+#endif
+
+#include "Segmentation/ComponentStatistics.h"
+#include "Segmentation/CpuFeature.h"
+#include "Segmentation/Instrumentation.h"
+#include "Segmentation/Labeling.h"
+
+// +----------------------------------------< RUN-LENGTH LABELING >-----------------------------------------+
+
+// Reserves the run buffers of 'workspace' for the most runs a binary 'width * height' mask holds: every other
+// pixel of a row, plus one for the split links of the first and of the last row. Frames of a size already seen
+// then never grow them, however busy.
+static void ReserveLabelRunWorkspace(LabelingWorkspace* workspace, size_t width, size_t height)
+{
+    const size_t runNumber = height * ((width + 1) / 2) + 2;
+
+    AcquireWorkspaceBuffer(workspace, workspace->run, workspace->run.size(), runNumber);
+    AcquireWorkspaceBuffer(workspace, workspace->equivalence, workspace->equivalence.size(), runNumber + 1);
+    AcquireWorkspaceBuffer(workspace, workspace->componentLabel, workspace->componentLabel.size(), runNumber + 1);
+    AcquireWorkspaceBuffer(workspace, workspace->labelHistogram, workspace->labelHistogram.size(), runNumber);
+    AcquireWorkspaceBuffer(workspace, workspace->keepTable, workspace->keepTable.size(), runNumber);
+}
+
+void EncodeLabelRun(const ImageView& image, std::vector<LabelRun>& run, std::vector<size_t>& rowRunIndex)
+{
+    assert(image.pointer != NULL);
+
+    const size_t width  = image.width;
+    const size_t height = image.height;
+
+    LabelRun labelRun;
+    size_t   ix = 0;
+
+    rowRunIndex.resize(height + 1);
+
+    for (size_t iy = 0; iy < height; ++iy)
+    {
+        const byte_t* row = ImageRow(image, iy);
+
+        rowRunIndex[iy] = run.size();
+        ix              = 0;
+
+        while (ix < width)
+        {
+            // Background dominates sparse masks, so skip it a word at a time.
+            while (ix + sizeof(uint64_t) <= width)
+            {
+                uint64_t word = 0;
+
+                memcpy(&word, row + ix, sizeof(word));
+
+                if (word != 0)
+                    break;
+
+                ix += sizeof(uint64_t);
+            }
+
+            while (ix < width && row[ix] == 0)
+                ++ix;
+
+            if (ix == width)
+                break;
+
+            labelRun.row         = static_cast<uint32_t>(iy);
+            labelRun.beginColumn = static_cast<uint32_t>(ix);
+            labelRun.label       = 0;
+            labelRun.value       = row[ix];
+
+            // Same horizontal links as TopDownPass and BottomUpPass: none between the first two pixels of the
+            // first row and between the last two pixels of the last row.
+            for (++ix; ix < width && row[ix] == labelRun.value; ++ix)
+                if (((iy + 1 < height && ix > 1) || (iy > 0 && ix + 1 < width)) == false)
+                    break;
+
+            labelRun.endColumn = static_cast<uint32_t>(ix);
+
+            run.push_back(labelRun);
+        }
+    }
+
+    rowRunIndex[height] = run.size();
+}
+
+// First column from 'ix' on whose pixel is at or above 'threshold' when 'foreground' is set, below it otherwise.
+// Returns 'width' when there is none.
+static inline size_t FindThresholdEdge(const byte_t* row, size_t ix, size_t width, byte_t threshold, bool foreground)
+{
+#if defined(SEGMENTATION_X86_64)
+    const __m128i thresholdVector = _mm_set1_epi8(static_cast<char>(threshold));
+    const int     edgeMask        = (foreground) ? (0) : (0xFFFF);
+
+    // max(x, t) == x exactly where x >= t, so the mask has a bit per foreground pixel. Blocks without an edge
+    // are skipped whole, the scalar loop below pins the edge down inside the first block holding one.
+    for (; ix + 16 <= width; ix += 16)
+    {
+        __m128i pixel = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + ix));
+
+        if ((_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(pixel, thresholdVector), pixel)) ^ edgeMask) != 0)
+            break;
+    }
+#endif
+
+    while (ix < width && (row[ix] >= threshold) != foreground)
+        ++ix;
+
+    return ix;
+}
+
+// Appends the runs of columns [beginColumn, endColumn) of row 'iy' of a 'width * height' frame, the pixels
+// beyond them counting as background.
+static void EncodeThresholdSegment(const byte_t* row, size_t beginColumn, size_t endColumn, size_t iy, size_t width, size_t height, byte_t threshold,
+                                   std::vector<LabelRun>& run)
+{
+    LabelRun labelRun;
+    size_t   ix = FindThresholdEdge(row, beginColumn, endColumn, threshold, true);
+
+    labelRun.row   = static_cast<uint32_t>(iy);
+    labelRun.label = 0;
+    labelRun.value = 255;
+
+    while (ix < endColumn)
+    {
+        labelRun.beginColumn = static_cast<uint32_t>(ix);
+
+        ix = CutLabelRunEnd(labelRun.beginColumn, FindThresholdEdge(row, ix + 1, endColumn, threshold, false), iy, width, height);
+
+        labelRun.endColumn = static_cast<uint32_t>(ix);
+
+        run.push_back(labelRun);
+
+        if (ix < endColumn && row[ix] < threshold)
+            ix = FindThresholdEdge(row, ix + 1, endColumn, threshold, true);
+    }
+}
+
+void EncodeThresholdRun(const ImageView& image, byte_t threshold, std::vector<LabelRun>& run, std::vector<size_t>& rowRunIndex)
+{
+    assert(image.pointer != NULL);
+    assert(image.width >= 3 && image.height >= 2);
+
+    rowRunIndex.resize(image.height + 1);
+
+    for (size_t iy = 0; iy < image.height; ++iy)
+    {
+        rowRunIndex[iy] = run.size();
+
+        EncodeThresholdSegment(ImageRow(image, iy), 0, image.width, iy, image.width, image.height, threshold, run);
+    }
+
+    rowRunIndex[image.height] = run.size();
+}
+
+void EncodeThresholdRegionRun(const ImageView& image, byte_t threshold, const ImageRegion* region, size_t regionNumber, std::vector<LabelRun>& run,
+                              std::vector<size_t>& rowRunIndex)
+{
+    assert(image.pointer != NULL);
+    assert(image.width >= 3 && image.height >= 2);
+    assert(region != NULL || regionNumber == 0);
+
+    rowRunIndex.resize(image.height + 1);
+
+    for (size_t iy = 0; iy < image.height; ++iy)
+    {
+        rowRunIndex[iy] = run.size();
+
+        for (size_t regionIndex = 0; regionIndex < regionNumber; ++regionIndex)
+            if (iy >= region[regionIndex].top && iy < region[regionIndex].top + region[regionIndex].height)
+                EncodeThresholdSegment(ImageRow(image, iy), region[regionIndex].left, region[regionIndex].left + region[regionIndex].width, iy,
+                                       image.width, image.height, threshold, run);
+    }
+
+    rowRunIndex[image.height] = run.size();
+}
+
+uint32_t RunLengthLabeling(const ImageView& image, std::vector<LabelRun>& run, const std::vector<size_t>& rowRunIndex,
+                           std::vector<uint32_t>& componentArea, LabelingWorkspace* workspace)
+{
+    return RunLengthLabeling(image.width, image.height, run, rowRunIndex, componentArea, workspace);
+}
+
+uint32_t RunLengthLabeling(size_t width, size_t height, std::vector<LabelRun>& run, const std::vector<size_t>& rowRunIndex,
+                           std::vector<uint32_t>& componentArea, LabelingWorkspace* workspace)
+{
+    assert(width >= 3);
+    assert(rowRunIndex.size() == height + 1);
+
+    LabelingWorkspace localWorkspace;
+
+    if (workspace == NULL)
+        workspace = &localWorkspace;
+
+    const uint32_t lastColumn = static_cast<uint32_t>(width - 1);
+
+    uint32_t* equivalence     = AcquireWorkspaceBuffer(workspace, workspace->equivalence, run.size() + 1);
+    uint32_t* componentLabel  = AcquireWorkspaceBuffer(workspace, workspace->componentLabel, run.size() + 1);
+    uint32_t  componentNumber = 0;
+    size_t    prevIndex       = 0;
+
+    // Run i carries provisional label i + 1. The smallest label of a component belongs to its first run in
+    // raster order, which UnionLabel keeps as the root.
+    for (size_t runIndex = 0; runIndex < run.size(); ++runIndex)
+    {
+        run[runIndex].label       = static_cast<uint32_t>(runIndex + 1);
+        equivalence[runIndex + 1] = static_cast<uint32_t>(runIndex + 1);
+    }
+
+    for (size_t iy = 1; iy < height; ++iy)
+    {
+        prevIndex = rowRunIndex[iy - 1];
+
+        for (size_t runIndex = rowRunIndex[iy]; runIndex < rowRunIndex[iy + 1]; ++runIndex)
+        {
+            const LabelRun& currentRun = run[runIndex];
+
+            while (prevIndex < rowRunIndex[iy] && run[prevIndex].endColumn < currentRun.beginColumn)
+                ++prevIndex;
+
+            // Runs overlap 8-connected when they share or touch a column. The pixel engines have no vertical
+            // link in the first and last column, so two single pixels stacked there stay apart.
+            for (size_t overlapIndex = prevIndex; overlapIndex < rowRunIndex[iy] && run[overlapIndex].beginColumn <= currentRun.endColumn; ++overlapIndex)
+            {
+                const LabelRun& prevRun = run[overlapIndex];
+
+                if (prevRun.value != currentRun.value)
+                    continue;
+
+                if (prevRun.endColumn - prevRun.beginColumn == 1 && currentRun.endColumn - currentRun.beginColumn == 1 &&
+                    prevRun.beginColumn == currentRun.beginColumn && (currentRun.beginColumn == 0 || currentRun.beginColumn == lastColumn))
+                    continue;
+
+                UnionLabel(equivalence, currentRun.label, prevRun.label);
+            }
+        }
+    }
+
+    for (size_t labelIndex = 1; labelIndex <= run.size(); ++labelIndex)
+    {
+        equivalence[labelIndex] = equivalence[equivalence[labelIndex]];
+
+        if (equivalence[labelIndex] == labelIndex)
+            componentLabel[labelIndex] = componentNumber++;
+    }
+
+    componentArea.assign(componentNumber, 0);
+
+    for (size_t runIndex = 0; runIndex < run.size(); ++runIndex)
+    {
+        run[runIndex].label = componentLabel[equivalence[run[runIndex].label]];
+
+        componentArea[run[runIndex].label] += run[runIndex].endColumn - run[runIndex].beginColumn;
+    }
+
+    return componentNumber;
+}
+
+byte_t* SelectLargeAreaRun(uint32_t componentNumber, uint32_t areaExtractNumber, LabelingWorkspace* workspace)
+{
+    assert(areaExtractNumber > 0);
+    assert(workspace != NULL);
+
+    std::vector<uint32_t>& labelHistogram = workspace->labelHistogram;
+    uint32_t*              extractedLabel = AcquireWorkspaceBuffer(workspace, workspace->extractedLabel, areaExtractNumber);
+    byte_t*                keepTable      = NULL;
+    uint32_t               labelNumber    = std::max<uint32_t>(1, componentNumber);
+
+    std::fill(extractedLabel, extractedLabel + areaExtractNumber, 0);
+
+    SEGMENTATION_COUNT(INSTRUMENTATION_COUNTER_COMPONENT, labelNumber);
+
+    // The label plane path renumbers the first component to 0, the value of the background, so its area is
+    // never counted and an empty mask still reports one label. Mirror that to extract the same components.
+    labelHistogram.resize(labelNumber);
+    labelHistogram[0] = 0;
+
+    {
+        SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_AREA_EXTRACTION, 0, sizeof(uint32_t) * labelNumber);
+
+        SelectLargeAreaLabel(labelHistogram.data(), labelNumber, extractedLabel, areaExtractNumber, workspace);
+    }
+
+    keepTable = AcquireWorkspaceBuffer(workspace, workspace->keepTable, labelNumber);
+
+    return MakeLabelKeepTable(extractedLabel, areaExtractNumber, labelNumber, keepTable);
+}
+
+byte_t* WriteLargeAreaRun(const ImageView& outputImage, uint32_t componentNumber, uint32_t areaExtractNumber, LabelingWorkspace* workspace)
+{
+    assert(outputImage.pointer != NULL);
+    assert(workspace != NULL);
+
+    const std::vector<LabelRun>& run        = workspace->run;
+    const byte_t*                keepTable  = SelectLargeAreaRun(componentNumber, areaExtractNumber, workspace);
+    const byte_t                 background = keepTable[0];
+
+    SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_MASK_OUTPUT, outputImage.width * outputImage.height, outputImage.width * outputImage.height);
+
+    for (size_t iy = 0; iy < outputImage.height; ++iy)
+        memset(ImageRow(outputImage, iy), background, sizeof(byte_t) * outputImage.width);
+
+    for (size_t runIndex = 0; runIndex < run.size(); ++runIndex)
+        if (keepTable[run[runIndex].label] != background)
+            memset(ImageRow(outputImage, run[runIndex].row) + run[runIndex].beginColumn, keepTable[run[runIndex].label],
+                   run[runIndex].endColumn - run[runIndex].beginColumn);
+
+    return outputImage.pointer;
+}
+
+uint32_t RunLabelRunPipeline(LabelingWorkspace* workspace, size_t width, size_t height, size_t pixelNumber, size_t byteNumber,
+                             const ImageView* intensityImage, ComponentStatistics* statistics, LabelRunEncoder encoder, const void* encode)
+{
+    assert(workspace != NULL);
+    assert(encoder   != NULL);
+    assert(IsLabelRunFrame(width, height));
+
+    // Only the instrumentation reads them.
+    (void)pixelNumber;
+    (void)byteNumber;
+
+    std::vector<LabelRun>& run             = workspace->run;
+    std::vector<size_t>&   rowRunIndex     = workspace->rowRunIndex;
+    std::vector<uint32_t>& labelHistogram  = workspace->labelHistogram;
+    size_t                 runCapacity     = 0;
+    size_t                 areaCapacity    = 0;
+    uint32_t               componentNumber = 0;
+
+    ReserveLabelRunWorkspace(workspace, width, height);
+
+    runCapacity  = run.capacity();
+    areaCapacity = labelHistogram.capacity();
+
+    run.clear();
+    AcquireWorkspaceBuffer(workspace, rowRunIndex, height + 1);
+
+    {
+        SEGMENTATION_SCOPE(INSTRUMENTATION_STAGE_RUN_LENGTH, pixelNumber, byteNumber);
+
+        encoder(encode, run, rowRunIndex);
+
+        componentNumber = RunLengthLabeling(width, height, run, rowRunIndex, labelHistogram, workspace);
+    }
+
+    if (statistics != NULL)
+    {
+        MeasureLabelRun(run, rowRunIndex, componentNumber, intensityImage, statistics);
+        FinishComponentStatistics(statistics);
+    }
+
+    // Masks with more values than 0 and 255 may hold more runs than reserved, which grow inside the encoder and
+    // RunLengthLabeling.
+    workspace->allocationNumber += ((run.capacity() > runCapacity) ? (1) : (0)) + ((labelHistogram.capacity() > areaCapacity) ? (1) : (0));
+
+    return componentNumber;
+}
+
+void CopyExtractedComponent(const LabelingWorkspace& workspace, uint32_t areaExtractNumber, uint32_t* extractedComponent)
+{
+    if (extractedComponent != NULL)
+        std::copy(workspace.extractedLabel.begin(), workspace.extractedLabel.begin() + areaExtractNumber, extractedComponent);
+}
+
+byte_t* RunLengthEfficient2Pass(const ImageView& inputImage, const ImageView& outputImage, uint32_t areaExtractNumber,
+                                LabelingWorkspace* workspace)
+{
+    assert(inputImage.pointer  != NULL);
+    assert(outputImage.pointer != NULL);
+    assert(IsSameImageSize(inputImage, outputImage));
+    assert(IsLabelRunFrame(inputImage.width, inputImage.height));
+    assert(areaExtractNumber > 0);
+
+    LabelingWorkspace localWorkspace;
+
+    if (workspace == NULL)
+        workspace = &localWorkspace;
+
+    const size_t pixelNumber     = inputImage.width * inputImage.height;
+    uint32_t     componentNumber = 0;
+
+    auto encode = [&](std::vector<LabelRun>& run, std::vector<size_t>& rowRunIndex) { EncodeLabelRun(inputImage, run, rowRunIndex); };
+
+    componentNumber = LabelRunPipeline(workspace, inputImage.width, inputImage.height, pixelNumber, pixelNumber, NULL, NULL, encode);
+
+    WriteLargeAreaRun(outputImage, componentNumber, areaExtractNumber, workspace);
+
+    return outputImage.pointer;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,228 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <cstdio>
+#include <vector>
+
+#include "Segmentation/Labeling.h"
+
+// +-----------------------------------------< STREAMING LABELING >-----------------------------------------+
+
+static uint32_t AllocateComponentSlot(LabelingStream* stream)
+{
+    uint32_t slot = 0;
+
+    if (stream->freeSlot.empty() == false)
+    {
+        slot = stream->freeSlot.back();
+        stream->freeSlot.pop_back();
+    }
+    else
+    {
+        slot = static_cast<uint32_t>(stream->component.size());
+
+        stream->component.push_back(StreamComponent());
+        stream->equivalence.push_back(0);
+        stream->lastRow.push_back(0);
+    }
+
+    stream->equivalence[slot] = slot;
+
+    return slot;
+}
+
+static uint32_t UnionComponentSlot(LabelingStream* stream, uint32_t slot1, uint32_t slot2)
+{
+    uint32_t root1 = FindRootLabel(stream->equivalence.data(), slot1);
+    uint32_t root2 = FindRootLabel(stream->equivalence.data(), slot2);
+    uint32_t root  = root1;
+
+    if (root1 == root2)
+        return root1;
+
+    root = UnionLabel(stream->equivalence.data(), root1, root2);
+
+    StreamComponent&       merged   = stream->component[root];
+    const StreamComponent& absorbed = stream->component[root1 + root2 - root];
+
+    merged.area   += absorbed.area;
+    merged.left    = std::min(merged.left, absorbed.left);
+    merged.top     = std::min(merged.top, absorbed.top);
+    merged.right   = std::max(merged.right, absorbed.right);
+    merged.bottom  = std::max(merged.bottom, absorbed.bottom);
+
+    return root;
+}
+
+void InitLabelingStream(LabelingStream* stream, size_t width)
+{
+    assert(stream != NULL);
+    assert(width > 0);
+
+    stream->width = width;
+    stream->row   = 0;
+
+    stream->prevRun.clear();
+    stream->currentRun.clear();
+    stream->component.clear();
+    stream->equivalence.clear();
+    stream->lastRow.clear();
+    stream->liveSlot.clear();
+    stream->nextLiveSlot.clear();
+    stream->freeSlot.clear();
+}
+
+void PushLabelingStreamRow(LabelingStream* stream, const byte_t* row, const ComponentSink& componentSink)
+{
+    assert(stream != NULL);
+    assert(row    != NULL);
+
+    const size_t width = stream->width;
+
+    LabelRun labelRun;
+    size_t   prevIndex = 0;
+    size_t   ix        = 0;
+
+    stream->currentRun.clear();
+
+    // Encode the row as runs of equal nonzero pixels.
+    while (ix < width)
+    {
+        while (ix < width && row[ix] == 0)
+            ++ix;
+
+        if (ix == width)
+            break;
+
+        labelRun.row         = static_cast<uint32_t>(stream->row);
+        labelRun.beginColumn = static_cast<uint32_t>(ix);
+        labelRun.value       = row[ix];
+
+        ++ix;
+
+        while (ix < width && row[ix] == labelRun.value)
+            ++ix;
+
+        labelRun.endColumn = static_cast<uint32_t>(ix);
+        labelRun.label     = UINT32_MAX;
+
+        stream->currentRun.push_back(labelRun);
+    }
+
+    // Attach every run to the components of the runs above it that touch it, merging them when it bridges more
+    // than one. Runs touching nothing open a new component.
+    for (size_t runIndex = 0; runIndex < stream->currentRun.size(); ++runIndex)
+    {
+        LabelRun& currentRun = stream->currentRun[runIndex];
+
+        while (prevIndex < stream->prevRun.size() && stream->prevRun[prevIndex].endColumn < currentRun.beginColumn)
+            ++prevIndex;
+
+        for (size_t overlapIndex = prevIndex; overlapIndex < stream->prevRun.size() && stream->prevRun[overlapIndex].beginColumn <= currentRun.endColumn; ++overlapIndex)
+        {
+            const LabelRun& prevRun = stream->prevRun[overlapIndex];
+
+            if (prevRun.value != currentRun.value)
+                continue;
+
+            currentRun.label = (currentRun.label == UINT32_MAX) ?
+                               (FindRootLabel(stream->equivalence.data(), prevRun.label)) : (UnionComponentSlot(stream, currentRun.label, prevRun.label));
+        }
+
+        if (currentRun.label == UINT32_MAX)
+        {
+            currentRun.label = AllocateComponentSlot(stream);
+
+            StreamComponent& component = stream->component[currentRun.label];
+
+            component.area   = 0;
+            component.left   = currentRun.beginColumn;
+            component.top    = stream->row;
+            component.right  = currentRun.endColumn - 1;
+            component.bottom = stream->row;
+            component.value  = currentRun.value;
+
+            stream->liveSlot.push_back(currentRun.label);
+        }
+    }
+
+    for (size_t runIndex = 0; runIndex < stream->currentRun.size(); ++runIndex)
+    {
+        LabelRun&        currentRun = stream->currentRun[runIndex];
+        uint32_t         root       = FindRootLabel(stream->equivalence.data(), currentRun.label);
+        StreamComponent& component  = stream->component[root];
+
+        component.area  += currentRun.endColumn - currentRun.beginColumn;
+        component.left   = std::min<size_t>(component.left, currentRun.beginColumn);
+        component.right  = std::max<size_t>(component.right, currentRun.endColumn - 1);
+        component.bottom = stream->row;
+
+        currentRun.label      = root;
+        stream->lastRow[root] = stream->row + 1;
+    }
+
+    // Slots absorbed by a merge are no longer referenced once the runs point at their roots. Roots missing from
+    // this row can't grow anymore.
+    stream->nextLiveSlot.clear();
+
+    for (size_t slotIndex = 0; slotIndex < stream->liveSlot.size(); ++slotIndex)
+    {
+        uint32_t slot = stream->liveSlot[slotIndex];
+
+        if (stream->equivalence[slot] == slot && stream->lastRow[slot] == stream->row + 1)
+        {
+            stream->nextLiveSlot.push_back(slot);
+            continue;
+        }
+
+        if (stream->equivalence[slot] == slot)
+            componentSink(stream->component[slot]);
+
+        stream->freeSlot.push_back(slot);
+    }
+
+    stream->liveSlot.swap(stream->nextLiveSlot);
+    stream->prevRun.swap(stream->currentRun);
+
+    ++stream->row;
+}
+
+void FinishLabelingStream(LabelingStream* stream, const ComponentSink& componentSink)
+{
+    assert(stream != NULL);
+
+    for (size_t slotIndex = 0; slotIndex < stream->liveSlot.size(); ++slotIndex)
+        componentSink(stream->component[stream->liveSlot[slotIndex]]);
+
+    InitLabelingStream(stream, stream->width);
+}
+
+size_t StreamComponentLabeling(const RowReader& rowReader, size_t width, const ComponentSink& componentSink)
+{
+    LabelingStream      stream;
+    std::vector<byte_t> row(width);
+    size_t              rowNumber = 0;
+
+    InitLabelingStream(&stream, width);
+
+    while (rowReader(row.data()))
+    {
+        PushLabelingStreamRow(&stream, row.data(), componentSink);
+        ++rowNumber;
+    }
+
+    FinishLabelingStream(&stream, componentSink);
+
+    return rowNumber;
+}
+
+size_t StreamComponentLabeling(FILE* file, size_t width, const ComponentSink& componentSink)
+{
+    assert(file != NULL);
+
+    return StreamComponentLabeling([file, width](byte_t* row) { return fread(row, sizeof(byte_t), width, file) == width; }, width, componentSink);
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,156 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cassert>
+
+#include "Segmentation/ThreadPool.h"
+
+// +------------------------------------------< GLOBAL VARIABLE >-------------------------------------------+
+
+// Set while the thread runs tasks of a loop, so loops nested in a task run inline.
+static thread_local bool insidePoolTask = false;
+
+// +--------------------------------------------< THREAD POOL >---------------------------------------------+
+
+ThreadPool::ThreadPool(size_t workerNumber)
+    : taskInvoker(NULL), task(NULL), taskNumber(0), nextTaskIndex(0), finishedTaskNumber(0), activeWorkerNumber(0), generation(0), stopping(false)
+{
+    if (workerNumber == static_cast<size_t>(-1))
+    {
+        size_t hardwareNumber = std::thread::hardware_concurrency();
+
+        workerNumber = (hardwareNumber > 1) ? (hardwareNumber - 1) : (0);
+    }
+
+    for (size_t workerIndex = 0; workerIndex < workerNumber; ++workerIndex)
+        worker.push_back(std::thread(&ThreadPool::WorkerLoop, this));
+}
+
+ThreadPool::~ThreadPool(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+
+    startCondition.notify_all();
+
+    for (size_t workerIndex = 0; workerIndex < worker.size(); ++workerIndex)
+        worker[workerIndex].join();
+}
+
+size_t ThreadPool::ThreadNumber(void) const
+{
+    return worker.size() + 1;
+}
+
+void ThreadPool::RunTask(TaskInvoker invoker, const void* function, size_t functionTaskNumber)
+{
+    size_t taskIndex      = 0;
+    size_t finishedNumber = 0;
+
+    insidePoolTask = true;
+
+    while ((taskIndex = nextTaskIndex.fetch_add(1)) < functionTaskNumber)
+    {
+        invoker(function, taskIndex);
+        finishedNumber++;
+    }
+
+    insidePoolTask = false;
+
+    if (finishedNumber > 0)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        finishedTaskNumber += finishedNumber;
+    }
+}
+
+void ThreadPool::WorkerLoop(void)
+{
+    TaskInvoker invoker            = NULL;
+    const void* function           = NULL;
+    size_t      functionTaskNumber = 0;
+    size_t      seenGeneration     = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+
+            startCondition.wait(lock, [&]() { return stopping || generation != seenGeneration; });
+
+            if (stopping)
+                return;
+
+            seenGeneration     = generation;
+            invoker            = taskInvoker;
+            function           = task;
+            functionTaskNumber = taskNumber;
+
+            if (function == NULL)
+                continue;
+
+            activeWorkerNumber++;
+        }
+
+        RunTask(invoker, function, functionTaskNumber);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            activeWorkerNumber--;
+        }
+
+        finishCondition.notify_all();
+    }
+}
+
+void ThreadPool::RunParallelFor(size_t taskNumber, TaskInvoker invoker, const void* function)
+{
+    if (taskNumber == 0)
+        return;
+
+    if (worker.empty() || taskNumber == 1 || insidePoolTask)
+    {
+        for (size_t taskIndex = 0; taskIndex < taskNumber; ++taskIndex)
+            invoker(function, taskIndex);
+
+        return;
+    }
+
+    // One loop at a time owns the task fields, the callers of other loops wait here until it finished.
+    std::lock_guard<std::mutex> callerLock(callerMutex);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        this->taskInvoker        = invoker;
+        this->task               = function;
+        this->taskNumber         = taskNumber;
+        this->finishedTaskNumber = 0;
+        this->nextTaskIndex      = 0;
+        this->generation++;
+    }
+
+    startCondition.notify_all();
+
+    RunTask(invoker, function, taskNumber);
+
+    // Waiting for the workers to leave RunTask too keeps a straggler from picking up an index of the next loop
+    // while still holding this loop's function.
+    std::unique_lock<std::mutex> lock(mutex);
+
+    finishCondition.wait(lock, [&]() { return finishedTaskNumber == this->taskNumber && activeWorkerNumber == 0; });
+
+    this->task = NULL;
+}
+
+ThreadPool& DefaultThreadPool(void)
+{
+    static ThreadPool threadPool;
+
+    return threadPool;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
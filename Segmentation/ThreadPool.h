@@ -0,0 +1,75 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef SEGMENTATION_THREAD_POOL_H
+#define SEGMENTATION_THREAD_POOL_H
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// +--------------------------------------------< THREAD POOL >---------------------------------------------+
+
+// Fixed set of worker threads running index-parallel loops. The calling thread takes part in every loop, so a
+// pool of N threads runs N + 1 tasks at once and a pool of zero workers degenerates into a serial loop. Any
+// number of threads may share a pool: their loops take turns, each one running on all the workers. A loop started
+// from inside a task of any pool runs inline on the calling thread, which would otherwise wait on itself.
+class ThreadPool
+{
+public:
+    // 'workerNumber' defaults to one less than the hardware concurrency.
+    explicit ThreadPool(size_t workerNumber = static_cast<size_t>(-1));
+    ~ThreadPool(void);
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Number of threads a ParallelFor spreads its tasks over, the caller included.
+    size_t ThreadNumber(void) const;
+
+    // Calls 'function(taskIndex)' for every index in [0, taskNumber) and returns once all of them finished.
+    // The workers call 'function' through a plain function pointer, so handing over a lambda never allocates.
+    template <typename Function>
+    void ParallelFor(size_t taskNumber, const Function& function)
+    {
+        RunParallelFor(taskNumber, &InvokeTask<Function>, &function);
+    }
+
+private:
+    typedef void (*TaskInvoker)(const void* function, size_t taskIndex);
+
+    template <typename Function>
+    static void InvokeTask(const void* function, size_t taskIndex)
+    {
+        (*static_cast<const Function*>(function))(taskIndex);
+    }
+
+    void WorkerLoop(void);
+    void RunParallelFor(size_t taskNumber, TaskInvoker invoker, const void* function);
+    void RunTask(TaskInvoker invoker, const void* function, size_t functionTaskNumber);
+
+    std::vector<std::thread>           worker;
+    std::mutex                         callerMutex;
+    std::mutex                         mutex;
+    std::condition_variable            startCondition;
+    std::condition_variable            finishCondition;
+    TaskInvoker                        taskInvoker;
+    const void*                        task;
+    size_t                             taskNumber;
+    std::atomic<size_t>                nextTaskIndex;
+    size_t                             finishedTaskNumber;
+    size_t                             activeWorkerNumber;
+    size_t                             generation;
+    bool                               stopping;
+};
+
+// Pool shared by the library's parallel paths when the caller doesn't pass one. Created on first use.
+ThreadPool& DefaultThreadPool(void);
+
+#endif
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,47 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cassert>
+#include <cinttypes>
+
+#include "Segmentation/Histogram.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +----------------------------------------< THRESHOLD SELECTION >-----------------------------------------+
+
+byte_t SelectThreshold(ThresholdMethod method, uint32_t* histogram, size_t width, size_t height, uint32_t cornerSum)
+{
+    assert(histogram != NULL);
+
+    double doubleHistogram[256];
+
+    switch (method)
+    {
+        case THRESHOLD_METHOD_OTSU:
+        case THRESHOLD_METHOD_KAPUR:
+            for (int brightness = 0; brightness < 256; ++brightness)
+                doubleHistogram[brightness] = histogram[brightness];
+
+            return (method == THRESHOLD_METHOD_OTSU) ?
+                   (PrefixSumOtsuThresholdSearch(doubleHistogram)) : (PrefixSumKapurThresholdSearch(doubleHistogram));
+
+        case THRESHOLD_METHOD_ITERATIVE:
+            return IterativeThresholdSearch(histogram, InitIterativeThresholdSelection(histogram, width, height, cornerSum));
+    }
+
+    assert(false);
+    return 0;
+}
+
+byte_t SelectThreshold(ThresholdMethod method, uint32_t* histogram, const ImageView& image)
+{
+    return SelectThreshold(method, histogram, image.width, image.height, SumImageCorner(image));
+}
+
+size_t ClampSampleStride(const ImageView& image, size_t sampleStride)
+{
+    assert(sampleStride > 0);
+
+    return (SampledLength(image.width, sampleStride) <= 2 || SampledLength(image.height, sampleStride) <= 2) ? (1) : (sampleStride);
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
@@ -0,0 +1,134 @@
+// +-------------------------------------------< PREPROCESSING >--------------------------------------------+
+
+#ifndef SEGMENTATION_THRESHOLD_SELECTION_H
+#define SEGMENTATION_THRESHOLD_SELECTION_H
+
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cinttypes>
+
+#include "Segmentation/Image.h"
+#include "Segmentation/ThreadPool.h"
+
+// +------------------------------------------< TYPE DEFINITION >-------------------------------------------+
+
+enum ThresholdMethod
+{
+    THRESHOLD_METHOD_OTSU,
+    THRESHOLD_METHOD_KAPUR,
+    THRESHOLD_METHOD_ITERATIVE
+};
+
+enum ThresholdSearchMode
+{
+    THRESHOLD_SEARCH_MODE_EXHAUSTIVE,
+    THRESHOLD_SEARCH_MODE_PREFIX_SUM
+};
+
+static const uint32_t MAX_MULTI_LEVEL_THRESHOLD_NUMBER = 7;
+
+// State of a per-stream threshold tracker. Prime it with InitThresholdTracker. 'histogram' is the sampled
+// histogram 'threshold' was last searched on; 'frameNumber' and 'searchNumber' count the frames seen and the
+// frames that needed a new search.
+struct ThresholdTracker
+{
+    ThresholdMethod method;
+    size_t          sampleStride;
+    double          changeBound;
+    uint32_t        histogram[256];
+    byte_t          threshold;
+    bool            primed;
+    size_t          frameNumber;
+    size_t          searchNumber;
+};
+
+// +----------------------------------------< THRESHOLD SELECTION >-----------------------------------------+
+
+// Every selector builds a 256-bin histogram of 'inputImage', picks a global threshold and writes the binarized
+// frame (0 below the threshold, 255 otherwise) to 'outputImage', which must have the same size. With a
+// 'sampleStride' above 1 the histogram only counts the lattice of ComputeSampledHistogram, which cuts the
+// histogram stage by about 'sampleStride^2' at the price of a threshold estimated from fewer pixels.
+byte_t OtsuThresholdSelection(const ImageView& inputImage, const ImageView& outputImage,
+                              ThresholdSearchMode searchMode = THRESHOLD_SEARCH_MODE_PREFIX_SUM, size_t sampleStride = 1);
+byte_t KapurThresholdSelection(const ImageView& inputImage, const ImageView& outputImage,
+                               ThresholdSearchMode searchMode = THRESHOLD_SEARCH_MODE_PREFIX_SUM, size_t sampleStride = 1);
+
+// Threshold searches over a 256-bin histogram. The exhaustive searches re-sum both classes for every candidate
+// (O(256^2)), the prefix-sum searches sweep cumulative count, mean and entropy tables once (O(256)). Otsu results
+// are bit-identical; Kapur entropies agree up to rounding.
+byte_t ExhaustiveOtsuThresholdSearch(const double* histogram);
+byte_t PrefixSumOtsuThresholdSearch(const double* histogram);
+byte_t ExhaustiveKapurThresholdSearch(const double* histogram);
+byte_t PrefixSumKapurThresholdSearch(const double* histogram);
+
+byte_t InitIterativeThresholdSelection(const ImageView& image);
+byte_t ComputeIterativeThresholdSelection(uint32_t* histogram, byte_t threshold);
+byte_t IterativeThresholdSelection(const ImageView& inputImage, const ImageView& outputImage, size_t sampleStride = 1);
+
+// The iterative method seeds its background mean from the four frame corners and its foreground mean from the
+// remaining pixels. Given the histogram and 'cornerSum', the seed needs no extra pass over the frame.
+uint32_t SumImageCorner(const ImageView& image);
+byte_t   InitIterativeThresholdSelection(const uint32_t* histogram, size_t width, size_t height, uint32_t cornerSum);
+byte_t   IterativeThresholdSearch(uint32_t* histogram, byte_t initialThreshold);
+
+// Picks the threshold of 'method' from a 256-bin histogram of a 'width * height' frame. 'cornerSum' is only
+// used by the iterative method.
+byte_t SelectThreshold(ThresholdMethod method, uint32_t* histogram, size_t width, size_t height, uint32_t cornerSum);
+byte_t SelectThreshold(ThresholdMethod method, uint32_t* histogram, const ImageView& image);
+
+// Sample stride actually used for 'image': 'sampleStride', or 1 when its lattice would be narrower or shorter than
+// the 3 samples the iterative seed needs.
+size_t ClampSampleStride(const ImageView& image, size_t sampleStride);
+
+// +----------------------------------< MULTI-LEVEL THRESHOLD SELECTION >-----------------------------------+
+
+// Splits a 256-bin histogram into 'thresholdNumber + 1' classes, at most MAX_MULTI_LEVEL_THRESHOLD_NUMBER
+// thresholds, maximizing the Otsu between-class variance or the sum of Kapur class entropies. 'threshold'
+// receives the increasing last bin of every class but the last one. The exhaustive search tries every tuple
+// (O(256^k)), the prefix-sum one runs a dynamic program over class criteria read from prefix sums (O(k * 256^2)).
+// Both return the same thresholds up to rounding. With one threshold they match the single threshold searches.
+void MultiLevelThresholdSearch(ThresholdMethod method, const double* histogram, uint32_t thresholdNumber, byte_t* threshold,
+                               ThresholdSearchMode searchMode = THRESHOLD_SEARCH_MODE_PREFIX_SUM);
+
+// Searches the thresholds of 'inputImage' with MultiLevelThresholdSearch and writes the level image of
+// QuantizeImage to 'outputImage'. 'method' is THRESHOLD_METHOD_OTSU or THRESHOLD_METHOD_KAPUR.
+void MultiLevelThresholdSelection(ThresholdMethod method, const ImageView& inputImage, const ImageView& outputImage, uint32_t thresholdNumber,
+                                  byte_t* threshold, ThresholdSearchMode searchMode = THRESHOLD_SEARCH_MODE_PREFIX_SUM);
+
+// +------------------------------------< ADAPTIVE THRESHOLD SELECTION >------------------------------------+
+
+// Number of tiles of 'tileSize' pixels covering 'imageSize' pixels along one axis, the last tile clipped.
+size_t AdaptiveThresholdTileNumber(size_t imageSize, size_t tileSize);
+
+// Locally adaptive selector for unevenly lit frames. The frame is cut into 'tileWidth * tileHeight' tiles, each
+// tile picks its own threshold with 'method' from its histogram, and every pixel is compared against the bilinear
+// interpolation of the thresholds at the four nearest tile centers. Tiles whose brightness range is narrower than
+// 'minimumContrast', and border tiles clipped below 3x3 pixels, take the global threshold instead, selected from
+// the sum of the tile histograms. Tiles are processed on 'threadPool', which defaults to DefaultThreadPool().
+// 'tileThreshold', if not NULL, receives the row-major tile thresholds. 'outputImage' may alias 'inputImage'.
+// Returns the global threshold.
+byte_t AdaptiveThresholdSelection(ThresholdMethod method, const ImageView& inputImage, const ImageView& outputImage, size_t tileWidth = 64,
+                                  size_t tileHeight = 64, uint32_t minimumContrast = 32, byte_t* tileThreshold = NULL,
+                                  ThreadPool* threadPool = NULL);
+
+// +-----------------------------------------< THRESHOLD TRACKING >-----------------------------------------+
+
+// Consecutive frames of a stream share almost the same histogram. The tracker histograms each frame on the
+// 'sampleStride' lattice of ComputeSampledHistogram and keeps the last threshold while the histogram stays within
+// 'changeBound' of the one it was searched on, measured as HistogramDistance. Otherwise it searches again, the
+// iterative method warm-started from the last threshold instead of the corner seed.
+void InitThresholdTracker(ThresholdTracker* tracker, ThresholdMethod method, size_t sampleStride = 4, double changeBound = 1.0);
+
+// Returns the threshold for 'image'. The first frame, and any frame after a reset, is always searched.
+byte_t TrackThreshold(ThresholdTracker* tracker, const ImageView& image);
+
+// Drops the tracked state after a scene cut, so the next frame is searched from scratch.
+void ResetThresholdTracker(ThresholdTracker* tracker);
+
+// Earth mover's distance between two histograms normalized to unit mass, in brightness levels: how far the
+// pixels of one have to move on average to match the other. A uniform lighting shift of d levels gives d.
+double HistogramDistance(const uint32_t* histogram1, const uint32_t* histogram2);
+
+#endif
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file
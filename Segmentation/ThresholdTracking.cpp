@@ -0,0 +1,109 @@
+// +----------------------------------------------< INCLUDE >-----------------------------------------------+
+
+#include <cassert>
+#include <cinttypes>
+#include <cmath>
+#include <cstring>
+
+#include "Segmentation/Histogram.h"
+#include "Segmentation/ThresholdSelection.h"
+
+// +-----------------------------------------< THRESHOLD TRACKING >-----------------------------------------+
+
+void InitThresholdTracker(ThresholdTracker* tracker, ThresholdMethod method, size_t sampleStride, double changeBound)
+{
+    assert(tracker != NULL);
+    assert(sampleStride > 0);
+
+    tracker->method       = method;
+    tracker->sampleStride = sampleStride;
+    tracker->changeBound  = changeBound;
+    tracker->frameNumber  = 0;
+    tracker->searchNumber = 0;
+
+    ResetThresholdTracker(tracker);
+}
+
+void ResetThresholdTracker(ThresholdTracker* tracker)
+{
+    assert(tracker != NULL);
+
+    memset(tracker->histogram, 0, sizeof(tracker->histogram));
+
+    tracker->threshold = 0;
+    tracker->primed    = false;
+}
+
+double HistogramDistance(const uint32_t* histogram1, const uint32_t* histogram2)
+{
+    assert(histogram1 != NULL);
+    assert(histogram2 != NULL);
+
+    double pixelNumber1      = 0.0;
+    double pixelNumber2      = 0.0;
+    double cumulativeNumber1 = 0.0;
+    double cumulativeNumber2 = 0.0;
+    double distance          = 0.0;
+
+    for (int brightness = 0; brightness < 256; ++brightness)
+    {
+        pixelNumber1 += histogram1[brightness];
+        pixelNumber2 += histogram2[brightness];
+    }
+
+    if (pixelNumber1 == 0.0 || pixelNumber2 == 0.0)
+        return (pixelNumber1 == pixelNumber2) ? (0.0) : (255.0);
+
+    // In one dimension the earth mover's distance is the area between the two cumulative distributions.
+    for (int brightness = 0; brightness < 255; ++brightness)
+    {
+        cumulativeNumber1 += histogram1[brightness];
+        cumulativeNumber2 += histogram2[brightness];
+
+        distance += std::fabs(cumulativeNumber1 / pixelNumber1 - cumulativeNumber2 / pixelNumber2);
+    }
+
+    return distance;
+}
+
+byte_t TrackThreshold(ThresholdTracker* tracker, const ImageView& image)
+{
+    assert(tracker       != NULL);
+    assert(image.pointer != NULL);
+
+    uint32_t histogram[256];
+    size_t   sampleStride = ClampSampleStride(image, tracker->sampleStride);
+
+    ComputeSampledHistogram(image, sampleStride, histogram);
+
+    ++tracker->frameNumber;
+
+    if (tracker->primed && HistogramDistance(histogram, tracker->histogram) < tracker->changeBound)
+        return tracker->threshold;
+
+    uint32_t lowerNumber = 0;
+    uint32_t pixelNumber = 0;
+
+    for (int brightness = 0; brightness < 256; ++brightness)
+    {
+        lowerNumber += (brightness <= tracker->threshold) ? (histogram[brightness]) : (0);
+        pixelNumber += histogram[brightness];
+    }
+
+    // Warm-starting needs both classes occupied at the last threshold; after a jump that empties one of them the
+    // iterative method falls back to its corner seed, read on the lattice.
+    if (tracker->method == THRESHOLD_METHOD_ITERATIVE && tracker->primed && lowerNumber > 0 && lowerNumber < pixelNumber)
+        tracker->threshold = IterativeThresholdSearch(histogram, tracker->threshold);
+    else
+        tracker->threshold = SelectThreshold(tracker->method, histogram, SampledLength(image.width, sampleStride),
+                                             SampledLength(image.height, sampleStride), SumImageCorner(image));
+
+    memcpy(tracker->histogram, histogram, sizeof(histogram));
+
+    tracker->primed = true;
+    ++tracker->searchNumber;
+
+    return tracker->threshold;
+}
+
+// +------------------------------------------------< END >-------------------------------------------------+
\ No newline at end of file